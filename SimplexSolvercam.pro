@@ -15,7 +15,15 @@ SOURCES += \
     simplexsolver.cpp \
     visualizationdialog.cpp \
     ocrprocessor.cpp \
-    cameracapture.cpp
+    cameracapture.cpp \
+    concurrentsimplexsolver.cpp \
+    mixedprecisionsimplexsolver.cpp \
+    grandentier.cpp \
+    rationnel.cpp \
+    verifiedsimplexsolver.cpp \
+    condensedsimplexsolver.cpp \
+    autosimplexsolver.cpp \
+    iissimplexsolver.cpp
 
 HEADERS += \
     MainWindow.h \
@@ -26,7 +34,18 @@ HEADERS += \
     simplexsolver.h \
     visualizationdialog.h \
     ocrprocessor.h \
-    cameracapture.h
+    cameracapture.h \
+    concurrentsimplexsolver.h \
+    factorisationlu.h \
+    mixedprecisionsimplexsolver.h \
+    grandentier.h \
+    rationnel.h \
+    verifiedsimplexsolver.h \
+    fixedsimplexsolver.h \
+    ressourcememoire.h \
+    condensedsimplexsolver.h \
+    autosimplexsolver.h \
+    iissimplexsolver.h
 
 # Add C++17 features if needed
 CONFIG += c++17
@@ -0,0 +1,232 @@
+#include "autosimplexsolver.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+using namespace std;
+
+AutoSimplexSolver::AutoSimplexSolver(ProblemePartage problemePartage)
+    : probleme(std::move(problemePartage)), problemeDeveloppe(ProblemeLineaire::sansIntervalles(probleme)) {
+
+    choix = FORMULATION_AUTO;
+    formulationResolue = FORMULATION_PRIMALE;
+    travailEstimePrimal = 0.0;
+    travailEstimeDual = 0.0;
+
+    etatSolution = EN_COURS;
+    valeurObjectif = 0.0;
+    nbIterations = 0;
+    unitesTravail = 0;
+
+    modeSilencieux = false;
+}
+
+double AutoSimplexSolver::estimerTravail(int lignes, int variables, int ecarts, int artificielles, double densite) {
+    // Pivots: au plus une entrée par variable de décision tant que la
+    // base de départ est réalisable, et une dizaine (pivots dégénérés de
+    // la phase 1, crash compris) par artificielle à chasser. Chaque pivot
+    // touche la ligne pivot et les lignes non nulles de la colonne
+    // entrante, sur toute la largeur; le tableau se remplit vite, d'où
+    // le facteur 2 sur la densité d'origine
+    double pivots = min(lignes, variables) + 10.0 * artificielles;
+    double largeur = variables + ecarts + artificielles + 1.0;
+    double remplissage = min(1.0, 2.0 * densite);
+    return pivots * largeur * (1.0 + remplissage * lignes);
+}
+
+void AutoSimplexSolver::estimerFormulations() {
+    const ProblemeLineaire& p = *problemeDeveloppe;
+    int m = p.matriceContraintes.size();
+    int n = p.fonctionObjectif.size();
+
+    long long nonNuls = 0;
+    for (const auto& ligne : p.matriceContraintes) {
+        for (double a : ligne) {
+            if (a != 0.0) nonNuls++;
+        }
+    }
+    double densite = (m > 0 && n > 0) ? static_cast<double>(nonNuls) / (static_cast<double>(m) * n) : 1.0;
+
+    // Primal: une ligne par contrainte, un écart par ligne LEQ/GEQ, une
+    // artificielle par ligne EQ ou GEQ une fois le second membre >= 0
+    int ecartsPrimal = 0, artificiellesPrimal = 0;
+    for (int i = 0; i < m; i++) {
+        TypeContrainte type = p.typesContraintes[i];
+        if (type != EQ) ecartsPrimal++;
+        if (type == EQ || (type == GEQ) == (p.Bi[i] >= 0.0)) artificiellesPrimal++;
+    }
+
+    // Dual (voir VueProblemeLineaire::dual): une ligne par
+    // variable, de second membre c_j, EQ pour une variable libre; GEQ
+    // pour x_j >= 0 en MAX ou x_j <= 0 en MIN
+    int ecartsDual = 0, artificiellesDual = 0;
+    for (int j = 0; j < n; j++) {
+        if (p.typesVariables[j] == UNRESTRICTED) {
+            artificiellesDual++;
+            continue;
+        }
+        ecartsDual++;
+        bool geq = (p.typesVariables[j] == NON_NEGATIVE) == (p.typeObj == MAX);
+        if (geq == (p.fonctionObjectif[j] >= 0.0)) artificiellesDual++;
+    }
+
+    travailEstimePrimal = estimerTravail(m, n, ecartsPrimal, artificiellesPrimal, densite);
+    travailEstimeDual = estimerTravail(n, m, ecartsDual, artificiellesDual, densite);
+}
+
+void AutoSimplexSolver::resoudrePrimal() {
+    formulationResolue = FORMULATION_PRIMALE;
+
+    SimplexSolver solver(*problemeDeveloppe);
+    solver.setModeSilencieux(true);
+    solver.solve();
+    nbIterations += solver.getNbIterations();
+    unitesTravail += solver.getUnitesTravail();
+
+    etatSolution = solver.getEtatSolution();
+    valeurObjectif = solver.getValeurObjectif();
+    solutionOptimale = solver.getSolutionOptimale();
+
+    if (solver.calculerValeursDuales(valeursDuales)) {
+        probleme->replierValeursDuales(valeursDuales);
+    }
+
+    // Ligne RANGE: les multiplicateurs de ses deux moitiés (>= 0 sur
+    // a.x <= u, <= 0 sur a.x >= l) se replient comme des prix ombres,
+    // et le certificat reste valable sur la ligne d'origine
+    rayonFarkas = solver.getRayonFarkas();
+    probleme->replierValeursDuales(rayonFarkas);
+    rayonNonBorne = solver.getRayonNonBorne();
+}
+
+bool AutoSimplexSolver::resoudreDual() {
+    formulationResolue = FORMULATION_DUALE;
+
+    // Dual lu dans le stockage du primal (transposée implicite)
+    SimplexSolver solver(VueProblemeLineaire::dual(*problemeDeveloppe));
+    solver.setModeSilencieux(true);
+    solver.solve();
+    nbIterations += solver.getNbIterations();
+    unitesTravail += solver.getUnitesTravail();
+
+    switch (solver.getEtatSolution()) {
+    case OPTIMALE: {
+        // x* = prix ombres des lignes du dual (une par variable primale),
+        // y* = solution du dual. Comme DualSimplexSolver, la paire n'est
+        // rendue que réalisable et sans écart de dualité; sinon le primal
+        // est résolu
+        vector<double> x;
+        if (!solver.calculerValeursDuales(x)) return false;
+        vector<double> y = solver.getSolutionOptimale();
+        ProblemeLineaire::ControlePaire controle = problemeDeveloppe->controlerPaire(x, y, TOLERANCE_PAIRE);
+        if (!controle.verifiee) {
+            journal() << "Paire primal-dual rejetee: residu " << scientific << setprecision(2)
+                      << controle.residuPrimal << ", ecart " << controle.ecartDualite << defaultfloat << endl;
+            return false;
+        }
+        etatSolution = OPTIMALE;
+        valeurObjectif = solver.getValeurObjectif();
+        solutionOptimale = std::move(x);
+        valeursDuales = std::move(y);
+        probleme->replierValeursDuales(valeursDuales);
+        return true;
+    }
+    case NON_BORNE:
+        // Dual non borné => primal infaisable. Le rayon du dual (une
+        // valeur par ligne primale), changé de signe pour un primal en
+        // MIN, est un rayon de Farkas du primal
+        etatSolution = INFAISABLE;
+        rayonFarkas = solver.getRayonNonBorne();
+        if (problemeDeveloppe->typeObj == MIN) {
+            for (double& v : rayonFarkas) v = -v;
+        }
+        if (!VueProblemeLineaire(*problemeDeveloppe).estRayonFarkas(rayonFarkas)) rayonFarkas.clear();
+        probleme->replierValeursDuales(rayonFarkas);
+        return true;
+    case LIMITE_ATTEINTE:
+        etatSolution = LIMITE_ATTEINTE;
+        return true;
+    default:
+        // Dual infaisable: primal infaisable ou non borné, seul le primal
+        // tranche
+        return false;
+    }
+}
+
+void AutoSimplexSolver::solve() {
+    etatSolution = EN_COURS;
+    valeurObjectif = 0.0;
+    solutionOptimale.clear();
+    valeursDuales.clear();
+    rayonFarkas.clear();
+    rayonNonBorne.clear();
+    nbIterations = 0;
+    unitesTravail = 0;
+
+    estimerFormulations();
+    ChoixFormulation formulation = choix;
+    if (formulation == FORMULATION_AUTO) {
+        formulation = (travailEstimeDual < travailEstimePrimal) ? FORMULATION_DUALE : FORMULATION_PRIMALE;
+    }
+
+    journal() << "\n=== CHOIX DE LA FORMULATION ===" << endl;
+    journal() << "Travail estime: primal " << scientific << setprecision(2) << travailEstimePrimal
+              << ", dual " << travailEstimeDual << defaultfloat << endl;
+
+    if (formulation == FORMULATION_DUALE) {
+        journal() << "Resolution du dual (" << problemeDeveloppe->fonctionObjectif.size() << " lignes au lieu de "
+                  << problemeDeveloppe->matriceContraintes.size() << ")" << endl;
+        if (!resoudreDual()) {
+            journal() << "Dual sans conclusion exploitable: resolution du primal" << endl;
+            resoudrePrimal();
+        }
+    } else {
+        journal() << "Resolution du primal" << endl;
+        resoudrePrimal();
+    }
+
+    if (!modeSilencieux) afficherSolution();
+}
+
+void AutoSimplexSolver::afficherSolution() const {
+    cout << "\n" << string(80, '=') << endl;
+    cout << "SOLUTION (formulation " << (formulationResolue == FORMULATION_DUALE ? "duale" : "primale")
+         << ", " << nbIterations << " iterations)" << endl;
+    cout << string(80, '=') << "\n\n";
+
+    if (etatSolution == OPTIMALE) {
+        cout << "*** SOLUTION OPTIMALE ATTEINTE ***\n\n";
+        cout << "Valeur optimale de Z = " << fixed << setprecision(4) << valeurObjectif << "\n\n";
+        for (size_t i = 0; i < solutionOptimale.size(); i++) {
+            cout << "  x" << (i + 1) << " = " << fixed << setprecision(4)
+                 << solutionOptimale[i] << endl;
+        }
+
+        if (!valeursDuales.empty()) {
+            cout << "\nValeurs duales (prix ombres):\n";
+            for (size_t i = 0; i < valeursDuales.size(); i++) {
+                cout << "  y" << (i + 1) << " = " << fixed << setprecision(4) << valeursDuales[i] << endl;
+            }
+        }
+    } else if (etatSolution == NON_BORNE) {
+        cout << "*** PROBLEME NON BORNE ***\n";
+        if (!rayonNonBorne.empty()) {
+            cout << "\nRayon ameliorant:\n";
+            for (size_t j = 0; j < rayonNonBorne.size(); j++) {
+                if (rayonNonBorne[j] != 0.0) cout << "  r" << (j + 1) << " = " << rayonNonBorne[j] << endl;
+            }
+        }
+    } else if (etatSolution == INFAISABLE) {
+        cout << "*** AUCUNE SOLUTION REALISABLE ***\n";
+        if (!rayonFarkas.empty()) {
+            cout << "\nCertificat de Farkas:\n";
+            for (size_t i = 0; i < rayonFarkas.size(); i++) {
+                if (rayonFarkas[i] != 0.0) cout << "  y" << (i + 1) << " = " << rayonFarkas[i] << endl;
+            }
+        }
+    } else if (etatSolution == LIMITE_ATTEINTE) {
+        cout << "*** ARRET AVANT LA FIN ***\n";
+    }
+
+    cout << "\n" << string(80, '=') << endl;
+}
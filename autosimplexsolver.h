@@ -0,0 +1,97 @@
+#ifndef AUTOSIMPLEXSOLVER_H
+#define AUTOSIMPLEXSOLVER_H
+
+#include "simplexsolver.h"
+#include <vector>
+#include <ostream>
+
+enum ChoixFormulation {
+    FORMULATION_AUTO,     // la moins chère d'après estimerTravail()
+    FORMULATION_PRIMALE,
+    FORMULATION_DUALE
+};
+
+//
+// Résout le primal ou son dual (VueProblemeLineaire::dual), selon
+// celui dont le tableau coûtera le moins, et rend toujours la solution du
+// primal: x*, valeur optimale et valeurs duales (prix ombres) de ses
+// contraintes.
+//
+// Le tableau a une ligne par contrainte: m x n donne m lignes au primal
+// et n au dual. Un pivot met à jour la ligne pivot et chaque ligne dont
+// le coefficient de la colonne entrante est non nul, sur toute la
+// largeur. Surtout, une ligne sans base de départ réalisable (EQ, GEQ de
+// second membre > 0) coûte une artificielle et la phase 1 qui va avec:
+// min c.x, A x >= b (c >= 0) en a m, son dual max b.y, A^T y <= c aucune.
+//
+// Les deux solutions se lisent sur une seule base optimale, refactorisée
+// (SimplexSolverT::calculerValeursDuales): les prix ombres du problème
+// résolu sont la solution de l'autre. Une paire lue sur la base du dual
+// n'est rendue que contrôlée (ProblemeLineaire::controlerPaire); rejetée,
+// le primal est résolu. Formulation imposée avec setFormulation().
+//
+class AutoSimplexSolver {
+private:
+    ProblemePartage probleme;
+    ProblemePartage problemeDeveloppe;   // lignes RANGE en deux lignes: bases sans bornes
+
+    ChoixFormulation choix;
+    ChoixFormulation formulationResolue;
+    double travailEstimePrimal;
+    double travailEstimeDual;
+
+    // Résultats (toujours ceux du primal)
+    TypeSolution etatSolution;
+    double valeurObjectif;
+    std::vector<double> solutionOptimale;
+    std::vector<double> valeursDuales;
+    std::vector<double> rayonFarkas;     // INFAISABLE: une valeur par contrainte d'origine
+    std::vector<double> rayonNonBorne;   // NON_BORNE: une valeur par variable
+    int nbIterations;
+    long long unitesTravail;
+
+    const double TOLERANCE_PAIRE = 1e-7;   // voir ProblemeLineaire::controlerPaire
+
+    bool modeSilencieux;
+
+    std::ostream& journal() const { return fluxJournal(modeSilencieux); }
+
+    void estimerFormulations();
+    void resoudrePrimal();
+    bool resoudreDual();
+
+public:
+    explicit AutoSimplexSolver(ProblemePartage problemePartage);
+
+    // Unités de travail (voir LimitesResolution) attendues pour un tableau
+    // de `lignes` contraintes sur `variables` variables de décision, avec
+    // `ecarts` variables d'écart, `artificielles` lignes partant d'une
+    // artificielle et une proportion `densite` de coefficients non nuls
+    static double estimerTravail(int lignes, int variables, int ecarts, int artificielles, double densite);
+
+    void setModeSilencieux(bool silencieux) { modeSilencieux = silencieux; }
+    void setFormulation(ChoixFormulation formulation) { choix = formulation; }
+
+    void solve();
+    void afficherSolution() const;
+
+    // Getters pour l'interface
+    TypeSolution getEtatSolution() const { return etatSolution; }
+    double getValeurObjectif() const { return valeurObjectif; }
+    std::vector<double> getSolutionOptimale() const { return solutionOptimale; }
+    // Une valeur par contrainte d'origine (vide si la base finale garde
+    // une artificielle et ne peut être refactorisée)
+    std::vector<double> getValeursDuales() const { return valeursDuales; }
+    // Certificats vérifiés (voir SimplexSolverT::getRayonFarkas), quelle
+    // que soit la formulation résolue: un rayon améliorant du dual est un
+    // rayon de Farkas du primal. Vides s'ils n'ont pas pu être établis
+    std::vector<double> getRayonFarkas() const { return rayonFarkas; }
+    std::vector<double> getRayonNonBorne() const { return rayonNonBorne; }
+    int getNbIterations() const { return nbIterations; }
+    long long getUnitesTravail() const { return unitesTravail; }
+    ChoixFormulation getFormulationResolue() const { return formulationResolue; }
+    double getTravailEstimePrimal() const { return travailEstimePrimal; }
+    double getTravailEstimeDual() const { return travailEstimeDual; }
+};
+
+#endif // AUTOSIMPLEXSOLVER_H
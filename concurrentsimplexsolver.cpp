@@ -0,0 +1,134 @@
+#include "concurrentsimplexsolver.h"
+#include "dualsimplexsolver.h"
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <chrono>
+#include <exception>
+
+using namespace std;
+
+ConcurrentSimplexSolver::ConcurrentSimplexSolver(ProblemePartage problemePartage)
+    : probleme(std::move(problemePartage)) {
+
+    moteurs = { MOTEUR_PRIMAL, MOTEUR_DUAL };
+
+    etatSolution = EN_COURS;
+    valeurObjectif = 0.0;
+    gagnantTrouve = false;
+    moteurGagnant = MOTEUR_PRIMAL;
+    tempsGagnantMs = 0.0;
+    arret = false;
+}
+
+string ConcurrentSimplexSolver::nomMoteur(MoteurResolution moteur) {
+    switch (moteur) {
+    case MOTEUR_PRIMAL: return "Simplexe primal (tableau)";
+    case MOTEUR_DUAL:   return "Simplexe sur le dual";
+    }
+    return "Inconnu";
+}
+
+void ConcurrentSimplexSolver::proposerResultat(MoteurResolution moteur, TypeSolution etat, double valeur,
+                                               const vector<double>& solution, double tempsMs) {
+    lock_guard<mutex> verrou(verrouResultat);
+    if (gagnantTrouve) return;
+
+    gagnantTrouve = true;
+    moteurGagnant = moteur;
+    etatSolution = etat;
+    valeurObjectif = valeur;
+    solutionOptimale = solution;
+    tempsGagnantMs = tempsMs;
+
+    // Demander aux autres moteurs de s'arrêter
+    arret.store(true);
+}
+
+void ConcurrentSimplexSolver::executerMoteur(MoteurResolution moteur) {
+    auto debut = chrono::steady_clock::now();
+
+    try {
+        if (moteur == MOTEUR_PRIMAL) {
+            SimplexSolver solver(*probleme);
+            solver.setModeSilencieux(true);
+            solver.setDrapeauArret(&arret);
+            solver.solve();
+
+            if (solver.estInterrompu() || solver.getEtatSolution() == EN_COURS) return;
+
+            double tempsMs = chrono::duration<double, milli>(chrono::steady_clock::now() - debut).count();
+            proposerResultat(moteur, solver.getEtatSolution(), solver.getValeurObjectif(),
+                             solver.getSolutionOptimale(), tempsMs);
+        } else {
+            DualSimplexSolver solver(probleme);
+            solver.setModeSilencieux(true);
+            solver.setDrapeauArret(&arret);
+            solver.solve();
+
+            // EN_COURS: dual infaisable, le primal peut être infaisable ou non borné
+            if (solver.estInterrompu() || solver.getEtatSolution() == EN_COURS) return;
+            // Optimum sans x* ou paire non vérifiée: la course revient au primal
+            if (solver.getEtatSolution() == OPTIMALE &&
+                (solver.getSolutionPrimal().empty() || !solver.estDualiteVerifiee())) {
+                return;
+            }
+
+            double tempsMs = chrono::duration<double, milli>(chrono::steady_clock::now() - debut).count();
+            proposerResultat(moteur, solver.getEtatSolution(), solver.getValeurObjectifPrimal(),
+                             solver.getSolutionPrimal(), tempsMs);
+        }
+    } catch (const exception&) {
+        // Un moteur en échec numérique abandonne simplement la course
+    }
+}
+
+void ConcurrentSimplexSolver::solve() {
+    etatSolution = EN_COURS;
+    gagnantTrouve = false;
+    arret = false;
+
+    vector<thread> threads;
+    for (auto moteur : moteurs) {
+        threads.emplace_back(&ConcurrentSimplexSolver::executerMoteur, this, moteur);
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+void ConcurrentSimplexSolver::afficherResultat() const {
+    cout << "\n" << string(80, '=') << endl;
+    cout << "RESOLUTION CONCURRENTE" << endl;
+    cout << string(80, '=') << "\n\n";
+
+    cout << "Moteurs en course:";
+    for (auto moteur : moteurs) {
+        cout << "\n  - " << nomMoteur(moteur);
+    }
+    cout << "\n\n";
+
+    if (!gagnantTrouve) {
+        cout << "*** AUCUN MOTEUR N'A CONCLU ***\n";
+        cout << "\n" << string(80, '=') << endl;
+        return;
+    }
+
+    cout << "Moteur gagnant: " << nomMoteur(moteurGagnant)
+         << " (" << fixed << setprecision(3) << tempsGagnantMs << " ms)\n\n";
+
+    if (etatSolution == OPTIMALE) {
+        cout << "*** SOLUTION OPTIMALE ATTEINTE ***\n\n";
+        cout << "Valeur optimale de Z = " << fixed << setprecision(4) << valeurObjectif << "\n";
+        for (size_t i = 0; i < solutionOptimale.size(); i++) {
+            cout << "  x" << (i + 1) << " = " << fixed << setprecision(4)
+                 << solutionOptimale[i] << endl;
+        }
+    } else if (etatSolution == NON_BORNE) {
+        cout << "*** PROBLEME NON BORNE ***\n";
+    } else if (etatSolution == INFAISABLE) {
+        cout << "*** AUCUNE SOLUTION REALISABLE ***\n";
+    }
+
+    cout << "\n" << string(80, '=') << endl;
+}
@@ -0,0 +1,64 @@
+#ifndef CONCURRENTSIMPLEXSOLVER_H
+#define CONCURRENTSIMPLEXSOLVER_H
+
+#include "simplexsolver.h"
+#include <vector>
+#include <string>
+#include <atomic>
+#include <mutex>
+
+// Moteurs pouvant participer à la course
+enum MoteurResolution {
+    MOTEUR_PRIMAL,   // Simplexe primal en tableau (deux phases)
+    MOTEUR_DUAL      // Simplexe appliqué au problème dual (DualSimplexSolver)
+};
+
+//
+// Lance en parallèle les deux moteurs de MoteurResolution, le simplexe
+// primal et le simplexe appliqué au dual, sur le même problème (pas de
+// point intérieur). Le premier qui conclut (optimum, infaisabilité ou
+// non-bornitude) gagne, l'autre est arrêté via un drapeau partagé lu à
+// chaque itération.
+// Si le moteur dual gagne, x* est lu sur la base optimale du dual.
+//
+class ConcurrentSimplexSolver {
+private:
+    ProblemePartage probleme;
+
+    std::vector<MoteurResolution> moteurs;
+
+    // Résultat du gagnant
+    TypeSolution etatSolution;
+    double valeurObjectif;
+    std::vector<double> solutionOptimale;
+    bool gagnantTrouve;
+    MoteurResolution moteurGagnant;
+    double tempsGagnantMs;
+
+    std::atomic<bool> arret;
+    std::mutex verrouResultat;
+
+    void executerMoteur(MoteurResolution moteur);
+    void proposerResultat(MoteurResolution moteur, TypeSolution etat, double valeur,
+                          const std::vector<double>& solution, double tempsMs);
+
+public:
+    explicit ConcurrentSimplexSolver(ProblemePartage problemePartage);
+
+    void setMoteurs(const std::vector<MoteurResolution>& liste) { moteurs = liste; }
+
+    void solve();
+    void afficherResultat() const;
+
+    static std::string nomMoteur(MoteurResolution moteur);
+
+    // Getters pour l'interface
+    TypeSolution getEtatSolution() const { return etatSolution; }
+    double getValeurObjectif() const { return valeurObjectif; }
+    std::vector<double> getSolutionOptimale() const { return solutionOptimale; }
+    bool aUnGagnant() const { return gagnantTrouve; }
+    MoteurResolution getMoteurGagnant() const { return moteurGagnant; }
+    double getTempsGagnantMs() const { return tempsGagnantMs; }
+};
+
+#endif // CONCURRENTSIMPLEXSOLVER_H
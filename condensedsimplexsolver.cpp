@@ -0,0 +1,396 @@
+#include "condensedsimplexsolver.h"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <utility>
+
+using namespace std;
+
+CondensedSimplexSolver::CondensedSimplexSolver(ProblemePartage problemePartage)
+    : probleme(ProblemeLineaire::sansIntervalles(std::move(problemePartage))) {
+
+    nbVariablesDecision = 0;
+    nbContraintes = 0;
+    ligneZ = 0;
+    ligneW = 0;
+    nbColonnesCompletes = 0;
+
+    etatSolution = EN_COURS;
+    valeurObjectif = 0.0;
+    nbIterations = 0;
+    unitesTravail = 0;
+    nbPivotsDegeneresConsecutifs = 0;
+    regleBland = false;
+
+    modeSilencieux = false;
+}
+
+void CondensedSimplexSolver::initialiserTableau() {
+    const ProblemeLineaire& p = *probleme;
+    int nbVariablesOriginales = p.fonctionObjectif.size();
+    nbContraintes = p.matriceContraintes.size();
+
+    // Variables de décision transformées (x <= 0 -> -x, s.r.s. -> x' - x'')
+    // et coûts de la forme MIN
+    vector<double> couts;
+    vector<double> signeColonne;
+    vector<int> colonneOrigine;
+    variableMapping.assign(nbVariablesOriginales, 0);
+    nomsVariables.clear();
+    for (int j = 0; j < nbVariablesOriginales; j++) {
+        variableMapping[j] = couts.size();
+        double c = (p.typeObj == MAX) ? -p.fonctionObjectif[j] : p.fonctionObjectif[j];
+        string nom = to_string(j + 1);
+
+        if (p.typesVariables[j] == NON_POSITIVE) {
+            nomsVariables.push_back("-x" + nom);
+            couts.push_back(-c);
+            signeColonne.push_back(-1.0);
+            colonneOrigine.push_back(j);
+        } else {
+            nomsVariables.push_back(p.typesVariables[j] == UNRESTRICTED ? "x" + nom + "'" : "x" + nom);
+            couts.push_back(c);
+            signeColonne.push_back(1.0);
+            colonneOrigine.push_back(j);
+            if (p.typesVariables[j] == UNRESTRICTED) {
+                nomsVariables.push_back("x" + nom + "''");
+                couts.push_back(-c);
+                signeColonne.push_back(-1.0);
+                colonneOrigine.push_back(j);
+            }
+        }
+    }
+    nbVariablesDecision = couts.size();
+    estArtificielle.assign(nbVariablesDecision, false);
+
+    // Écarts et artificielles; seconds membres ramenés à >= 0
+    vector<TypeContrainte> types(p.typesContraintes);
+    vector<double> signeLigne(nbContraintes, 1.0);
+    base.assign(nbContraintes, -1);
+    horsBase.clear();
+    for (int j = 0; j < nbVariablesDecision; j++) {
+        horsBase.push_back(j);
+    }
+
+    int nbEcart = 0, nbArtif = 0;
+    vector<int> colonneExcedent(nbContraintes, -1);
+    for (int i = 0; i < nbContraintes; i++) {
+        if (p.Bi[i] < 0) {
+            signeLigne[i] = -1.0;
+            if (types[i] == LEQ) types[i] = GEQ;
+            else if (types[i] == GEQ) types[i] = LEQ;
+        }
+
+        if (types[i] != EQ) {
+            nomsVariables.push_back("t" + to_string(++nbEcart));
+            estArtificielle.push_back(false);
+            if (types[i] == LEQ) {
+                base[i] = nomsVariables.size() - 1;
+            } else {
+                colonneExcedent[i] = horsBase.size();
+                horsBase.push_back(nomsVariables.size() - 1);
+            }
+        }
+        if (types[i] != LEQ) {
+            nomsVariables.push_back("w" + to_string(++nbArtif));
+            estArtificielle.push_back(true);
+            base[i] = nomsVariables.size() - 1;
+        }
+    }
+    nbColonnesCompletes = nbVariablesDecision + nbEcart + nbArtif;
+
+    // Lignes des contraintes, puis Z et W
+    int nbColonnes = horsBase.size();
+    ligneZ = nbContraintes;
+    ligneW = nbContraintes + 1;
+    tableau.assign(nbContraintes + 2, vector<double>(nbColonnes, 0.0));
+    secondMembre.assign(nbContraintes + 2, 0.0);
+
+    for (int i = 0; i < nbContraintes; i++) {
+        for (int k = 0; k < nbVariablesDecision; k++) {
+            tableau[i][k] = signeLigne[i] * signeColonne[k] * p.matriceContraintes[i][colonneOrigine[k]];
+        }
+        if (colonneExcedent[i] >= 0) tableau[i][colonneExcedent[i]] = -1.0;
+        secondMembre[i] = signeLigne[i] * p.Bi[i];
+    }
+
+    // Base initiale d'écarts et d'artificielles, de coût nul: les coûts
+    // réduits de Z sont les coûts eux-mêmes
+    for (int k = 0; k < nbVariablesDecision; k++) {
+        tableau[ligneZ][k] = couts[k];
+    }
+
+    // W = somme des artificielles, exprimée en variables hors base
+    for (int i = 0; i < nbContraintes; i++) {
+        if (!estArtificielle[base[i]]) continue;
+        for (int j = 0; j < nbColonnes; j++) {
+            tableau[ligneW][j] -= tableau[i][j];
+        }
+        secondMembre[ligneW] -= secondMembre[i];
+    }
+}
+
+int CondensedSimplexSolver::trouverColonnePivot(int ligneObjectif) const {
+    int colPivot = -1;
+    double minVal = -EPSILON;
+    for (int j = 0; j < static_cast<int>(horsBase.size()); j++) {
+        double d = tableau[ligneObjectif][j];
+        if (d >= -EPSILON) continue;
+        // Bland: plus petit indice de variable (les colonnes sont permutées)
+        if (regleBland) {
+            if (colPivot == -1 || horsBase[j] < horsBase[colPivot]) colPivot = j;
+        } else if (d < minVal) {
+            minVal = d;
+            colPivot = j;
+        }
+    }
+    return colPivot;
+}
+
+int CondensedSimplexSolver::trouverLignePivot(int colPivot) const {
+    int lignePivot = -1;
+    double minRatio = 0.0;
+    for (int i = 0; i < nbContraintes; i++) {
+        double a = tableau[i][colPivot];
+        if (a <= EPSILON) continue;
+        double ratio = max(secondMembre[i], 0.0) / a;
+        if (lignePivot == -1 || ratio < minRatio - EPSILON ||
+            (regleBland && ratio <= minRatio + EPSILON && base[i] < base[lignePivot])) {
+            lignePivot = i;
+            minRatio = ratio;
+        }
+    }
+    return lignePivot;
+}
+
+void CondensedSimplexSolver::pivoter(int lignePivot, int colPivot) {
+    int nbColonnes = horsBase.size();
+    int nbLignes = tableau.size();
+    vector<double>& ligne = tableau[lignePivot];
+    double pivot = ligne[colPivot];
+
+    for (int j = 0; j < nbColonnes; j++) {
+        if (j != colPivot) ligne[j] /= pivot;
+    }
+    secondMembre[lignePivot] /= pivot;
+    unitesTravail += nbColonnes;
+
+    for (int i = 0; i < nbLignes; i++) {
+        if (i == lignePivot) continue;
+        double facteur = tableau[i][colPivot];
+        if (facteur == 0.0) continue;
+        for (int j = 0; j < nbColonnes; j++) {
+            if (j != colPivot) tableau[i][j] -= facteur * ligne[j];
+        }
+        secondMembre[i] -= facteur * secondMembre[lignePivot];
+        tableau[i][colPivot] = -facteur / pivot;
+        unitesTravail += nbColonnes;
+    }
+    ligne[colPivot] = 1.0 / pivot;
+
+    // Échange des en-têtes; une artificielle sortante n'a plus d'usage
+    swap(base[lignePivot], horsBase[colPivot]);
+    if (estArtificielle[horsBase[colPivot]]) retirerColonne(colPivot);
+}
+
+void CondensedSimplexSolver::retirerColonne(int colonne) {
+    int derniere = horsBase.size() - 1;
+    for (vector<double>& ligne : tableau) {
+        ligne[colonne] = ligne[derniere];
+        ligne.pop_back();
+    }
+    horsBase[colonne] = horsBase[derniere];
+    horsBase.pop_back();
+}
+
+void CondensedSimplexSolver::retirerLigne(int ligne) {
+    tableau.erase(tableau.begin() + ligne);
+    secondMembre.erase(secondMembre.begin() + ligne);
+    base.erase(base.begin() + ligne);
+    nbContraintes--;
+    ligneZ--;
+    ligneW--;
+}
+
+bool CondensedSimplexSolver::iterer(int ligneObjectif, bool isPhase1) {
+    nbPivotsDegeneresConsecutifs = 0;
+    regleBland = false;
+
+    int iteration = 0;
+    afficherTableau(iteration++, isPhase1);
+
+    while (true) {
+        int colPivot = trouverColonnePivot(ligneObjectif);
+        if (colPivot == -1) return true;
+
+        int lignePivot = trouverLignePivot(colPivot);
+        if (lignePivot == -1) return false;
+
+        journal() << "\nIteration " << iteration << ": Variable entrante = "
+             << nomsVariables[horsBase[colPivot]] << ", Variable sortante = "
+             << nomsVariables[base[lignePivot]] << endl;
+
+        if (fabs(secondMembre[lignePivot]) <= EPSILON) {
+            if (++nbPivotsDegeneresConsecutifs >= SEUIL_STAGNATION) regleBland = true;
+        } else {
+            nbPivotsDegeneresConsecutifs = 0;
+            regleBland = false;
+        }
+
+        pivoter(lignePivot, colPivot);
+        nbIterations++;
+
+        afficherTableau(iteration++, isPhase1);
+    }
+}
+
+void CondensedSimplexSolver::sortirArtificiellesDeLaBase() {
+    // Artificielles restées en base au niveau zéro: pivot dégénéré sur le
+    // plus grand coefficient de leur ligne; sans coefficient, la ligne est
+    // redondante et disparaît du tableau
+    for (int i = nbContraintes - 1; i >= 0; i--) {
+        if (!estArtificielle[base[i]]) continue;
+
+        int colonne = -1;
+        double maxVal = EPSILON;
+        for (int j = 0; j < static_cast<int>(horsBase.size()); j++) {
+            if (fabs(tableau[i][j]) > maxVal) {
+                maxVal = fabs(tableau[i][j]);
+                colonne = j;
+            }
+        }
+
+        if (colonne == -1) {
+            journal() << "Ligne redondante: " << nomsVariables[base[i]] << " et sa ligne sont retirees\n";
+            retirerLigne(i);
+            continue;
+        }
+
+        journal() << "Pivot degenere: " << nomsVariables[horsBase[colonne]]
+             << " remplace " << nomsVariables[base[i]] << "\n";
+        secondMembre[i] = 0.0;
+        pivoter(i, colonne);
+    }
+}
+
+void CondensedSimplexSolver::extraireSolution() {
+    const ProblemeLineaire& p = *probleme;
+    vector<double> valeurs(nomsVariables.size(), 0.0);
+    for (int i = 0; i < nbContraintes; i++) {
+        valeurs[base[i]] = secondMembre[i];
+    }
+
+    int nbVariablesOriginales = p.fonctionObjectif.size();
+    solutionOptimale.assign(nbVariablesOriginales, 0.0);
+    valeurObjectif = 0.0;
+    for (int j = 0; j < nbVariablesOriginales; j++) {
+        int k = variableMapping[j];
+        double x = valeurs[k];
+        if (p.typesVariables[j] == NON_POSITIVE) x = -x;
+        if (p.typesVariables[j] == UNRESTRICTED) x -= valeurs[k + 1];
+        solutionOptimale[j] = x;
+        valeurObjectif += p.fonctionObjectif[j] * x;
+    }
+}
+
+void CondensedSimplexSolver::solve() {
+    journal() << "\n" << string(80, '=') << endl;
+    journal() << "RESOLUTION PAR LE SIMPLEXE EN TABLEAU CONDENSE" << endl;
+    journal() << string(80, '=') << "\n";
+
+    initialiserTableau();
+    nbIterations = 0;
+    unitesTravail = 0;
+    solutionOptimale.clear();
+    valeurObjectif = 0.0;
+
+    journal() << "\nColonnes stockees: " << horsBase.size() << " (tableau complet: "
+         << nbColonnesCompletes << ")\n";
+
+    bool aDesArtificielles = false;
+    for (int i = 0; i < nbContraintes; i++) {
+        if (estArtificielle[base[i]]) aDesArtificielles = true;
+    }
+
+    if (aDesArtificielles) {
+        journal() << "\n=== PHASE 1: Elimination des variables artificielles ===\n";
+        iterer(ligneW, true);
+
+        if (-secondMembre[ligneW] > EPSILON) {
+            journal() << "\n*** Phase 1 ECHEC: W = " << -secondMembre[ligneW] << " > 0 ***\n";
+            etatSolution = INFAISABLE;
+            afficherSolution();
+            return;
+        }
+        sortirArtificiellesDeLaBase();
+    }
+
+    // La ligne Z a suivi tous les pivots: seule W disparaît
+    tableau.pop_back();
+    secondMembre.pop_back();
+
+    journal() << "\n=== PHASE 2: Optimisation de la fonction objectif ===\n";
+    if (iterer(ligneZ, false)) {
+        etatSolution = OPTIMALE;
+        extraireSolution();
+    } else {
+        etatSolution = NON_BORNE;
+    }
+    afficherSolution();
+}
+
+void CondensedSimplexSolver::afficherTableau(int iteration, bool isPhase1) const {
+    if (modeSilencieux) return;
+
+    string phaseLabel = isPhase1 ? " (Phase 1)" : " (Phase 2)";
+    if (iteration == 0) {
+        journal() << "\n--- TABLEAU CONDENSE INITIAL" << phaseLabel << " ---\n";
+    } else {
+        journal() << "\n--- Iteration " << iteration << phaseLabel << " ---\n";
+    }
+
+    int nbColonnes = horsBase.size();
+    journal() << setw(8) << "Base" << " | ";
+    for (int j = 0; j < nbColonnes; j++) {
+        journal() << setw(10) << nomsVariables[horsBase[j]];
+    }
+    journal() << setw(10) << "b" << endl;
+    journal() << string(12 + 10 * (nbColonnes + 1), '-') << endl;
+
+    auto afficherLigne = [&](const string& entete, int i) {
+        journal() << setw(8) << entete << " | ";
+        for (int j = 0; j < nbColonnes; j++) {
+            journal() << setw(10) << fixed << setprecision(3) << tableau[i][j];
+        }
+        journal() << setw(10) << fixed << setprecision(3) << secondMembre[i] << endl;
+    };
+
+    for (int i = 0; i < nbContraintes; i++) {
+        afficherLigne(nomsVariables[base[i]], i);
+    }
+    journal() << string(12 + 10 * (nbColonnes + 1), '-') << endl;
+    afficherLigne(probleme->typeObj == MIN ? "zj-cj" : "cj-zj", ligneZ);
+    if (isPhase1) afficherLigne("W", ligneW);
+}
+
+void CondensedSimplexSolver::afficherSolution() const {
+    journal() << "\n" << string(80, '=') << endl;
+    journal() << "SOLUTION FINALE (TABLEAU CONDENSE)" << endl;
+    journal() << string(80, '=') << "\n\n";
+
+    if (etatSolution == OPTIMALE) {
+        journal() << "*** SOLUTION OPTIMALE ATTEINTE ***\n\n";
+        journal() << "Valeur optimale de Z = " << fixed << setprecision(4) << valeurObjectif << "\n\n";
+        journal() << "Variables de decision:\n";
+        for (size_t i = 0; i < solutionOptimale.size(); i++) {
+            journal() << "  x" << (i + 1) << " = " << fixed << setprecision(4) << solutionOptimale[i] << endl;
+        }
+        journal() << "\nIterations: " << nbIterations << ", coefficients mis a jour: " << unitesTravail << "\n";
+    } else if (etatSolution == NON_BORNE) {
+        journal() << "*** PROBLEME NON BORNE ***\n";
+    } else if (etatSolution == INFAISABLE) {
+        journal() << "*** AUCUNE SOLUTION REALISABLE ***\n";
+    }
+
+    journal() << "\n" << string(80, '=') << endl;
+}
@@ -0,0 +1,100 @@
+#ifndef CONDENSEDSIMPLEXSOLVER_H
+#define CONDENSEDSIMPLEXSOLVER_H
+
+#include "simplexsolver.h"
+#include <vector>
+#include <string>
+#include <ostream>
+
+//
+// Simplexe à deux phases sur un tableau condensé (tableau de Tucker):
+// seules les colonnes hors base sont stockées, celle d'une variable de
+// base n'étant qu'un vecteur unité. Un pivot sur a_rs échange l'en-tête
+// de la ligne r et celui de la colonne s:
+//
+//   pivot       a_rs  ->  1 / a_rs
+//   ligne r     a_rj  ->  a_rj / a_rs
+//   colonne s   a_is  -> -a_is / a_rs
+//   autres      a_ij  ->  a_ij - a_is * a_rj / a_rs
+//
+// Avec m contraintes <= sur n variables, le tableau complet compte n + m
+// colonnes et le condensé n: mémoire et travail par pivot divisés par
+// deux quand m ~ n. Une artificielle qui quitte la base perd aussitôt sa
+// colonne. Les lignes Z (coûts) et W (phase 1) suivent toutes deux les
+// pivots: la phase 2 démarre sans reconstruire l'objectif.
+//
+class CondensedSimplexSolver {
+private:
+    ProblemePartage probleme;   // lignes RANGE développées (sansIntervalles)
+
+    // Modèle transformé: variables >= 0, seconds membres >= 0. Indices
+    // des variables: décision, puis écart/excédent et artificielle de
+    // chaque ligne
+    int nbVariablesDecision;
+    std::vector<int> variableMapping;     // variable d'origine -> première colonne transformée
+    std::vector<std::string> nomsVariables;
+    std::vector<bool> estArtificielle;
+
+    // Tableau condensé: nbContraintes lignes puis Z et W, une colonne par
+    // variable hors base; le second membre est rangé à part
+    std::vector<std::vector<double>> tableau;
+    std::vector<double> secondMembre;
+    std::vector<int> base;        // variable de base de chaque ligne
+    std::vector<int> horsBase;    // variable de chaque colonne
+    int nbContraintes;
+    int ligneZ;
+    int ligneW;
+    int nbColonnesCompletes;      // largeur du tableau de SimplexSolver
+
+    // Résultats
+    TypeSolution etatSolution;
+    double valeurObjectif;
+    std::vector<double> solutionOptimale;
+    int nbIterations;
+    long long unitesTravail;
+
+    // Anti-cyclage, comme SimplexSolver: règle de Bland après
+    // SEUIL_STAGNATION pivots dégénérés consécutifs
+    static const int SEUIL_STAGNATION = 50;
+    int nbPivotsDegeneresConsecutifs;
+    bool regleBland;
+
+    const double EPSILON = 1e-10;
+
+    bool modeSilencieux;
+
+    std::ostream& journal() const { return fluxJournal(modeSilencieux); }
+
+    void initialiserTableau();
+    bool iterer(int ligneObjectif, bool isPhase1);
+    int trouverColonnePivot(int ligneObjectif) const;
+    int trouverLignePivot(int colPivot) const;
+    void pivoter(int lignePivot, int colPivot);
+    void retirerColonne(int colonne);
+    void retirerLigne(int ligne);
+    void sortirArtificiellesDeLaBase();
+    void extraireSolution();
+
+public:
+    explicit CondensedSimplexSolver(ProblemePartage problemePartage);
+
+    void setModeSilencieux(bool silencieux) { modeSilencieux = silencieux; }
+
+    void solve();
+    void afficherTableau(int iteration, bool isPhase1) const;
+    void afficherSolution() const;
+
+    // Getters pour l'interface
+    TypeSolution getEtatSolution() const { return etatSolution; }
+    double getValeurObjectif() const { return valeurObjectif; }
+    std::vector<double> getSolutionOptimale() const { return solutionOptimale; }
+    int getNbIterations() const { return nbIterations; }
+    long long getUnitesTravail() const { return unitesTravail; }
+
+    // Largeur (hors second membre) du tableau condensé actuel et de celui
+    // que stockerait SimplexSolver pour le même modèle
+    int getNbColonnesCondensees() const { return static_cast<int>(horsBase.size()); }
+    int getNbColonnesCompletes() const { return nbColonnesCompletes; }
+};
+
+#endif // CONDENSEDSIMPLEXSOLVER_H
@@ -2,122 +2,139 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <cmath>
+#include <algorithm>
 
 using namespace std;
 
-DualSimplexSolver::DualSimplexSolver(const std::vector<double>& fobj,
-                                     const std::vector<std::vector<double>>& contraintes,
-                                     const std::vector<double>& b,
-                                     const std::vector<TypeContrainte>& types,
-                                     TypeObjectif type,
-                                     const std::vector<TypeVariable>& typesVar) {
-    // Sauvegarder le problème primal
-    fonctionObjectifPrimal = fobj;
-    matriceContraintesPrimal = contraintes;
-    BiPrimal = b;
-    typesContraintesPrimal = types;
-    typeObjPrimal = type;
-    typesVariablesPrimal = typesVar.empty() ?
-                               std::vector<TypeVariable>(fobj.size(), NON_NEGATIVE) : typesVar;
-
+DualSimplexSolver::DualSimplexSolver(ProblemePartage problemePartage)
+    : probleme(std::move(problemePartage)), primal(ProblemeLineaire::sansIntervalles(probleme)),
+    dual(VueProblemeLineaire::dual(*primal)) {
     etatSolution = EN_COURS;
     valeurObjectifPrimal = 0.0;
     valeurObjectifDual = 0.0;
+    ecartDualite = 0.0;
+    residuPrimal = 0.0;
+    dualiteVerifiee = false;
+
+    modeSilencieux = false;
+    drapeauArret = nullptr;
+    interrompu = false;
 }
 
 void DualSimplexSolver::transformerPrimalVersDual() {
-    int m = matriceContraintesPrimal.size(); // nombre de contraintes primal
-    int n = fonctionObjectifPrimal.size();   // nombre de variables primal
+    journal() << "\n=== TRANSFORMATION PRIMAL -> DUAL ===" << endl;
+
+    // Vue duale construite avec le solveur: la transposée reste implicite
+    journal() << "Objectif primal: " << (primal->typeObj == MAX ? "MAX" : "MIN")
+         << " → Objectif dual: " << (dual.getTypeObjectif() == MAX ? "MAX" : "MIN") << endl;
+    journal() << "Fonction objectif dual: coefficients = Bi du primal" << endl;
+    journal() << "Matrice des contraintes dual: transposée de la matrice primal (lue sans copie)" << endl;
+    journal() << "Termes de droite dual: coefficients de la fonction objectif primal" << endl;
+    journal() << "Types de contraintes dual: basés sur les types de variables primal" << endl;
+    journal() << "Types de variables dual: basés sur les types de contraintes primal" << endl;
+}
 
-    cout << "\n=== TRANSFORMATION PRIMAL -> DUAL ===" << endl;
+void DualSimplexSolver::resoudreDualAvecSimplex() {
+    journal() << "\n=== RESOLUTION DU PROBLEME DUAL PAR SIMPLEXE ===" << endl;
 
-    // 1. Type d'objectif dual
-    typeObjDual = (typeObjPrimal == MAX) ? MIN : MAX;
-    cout << "Objectif primal: " << (typeObjPrimal == MAX ? "MAX" : "MIN")
-         << " → Objectif dual: " << (typeObjDual == MAX ? "MAX" : "MIN") << endl;
+    // Créer et résoudre le problème dual avec SimplexSolver
+    SimplexSolver solverDual(dual);
+    solverDual.setModeSilencieux(modeSilencieux);
+    solverDual.setDrapeauArret(drapeauArret);
 
-    // 2. Fonction objectif dual = termes de droite primal
-    fonctionObjectifDual = BiPrimal;
-    cout << "Fonction objectif dual: coefficients = Bi du primal" << endl;
+    solverDual.solve();
 
-    // 3. Matrice des contraintes dual = transposée de la matrice primal
-    matriceContraintesDual.resize(n, std::vector<double>(m));
-    for (int i = 0; i < m; i++) {
-        for (int j = 0; j < n; j++) {
-            matriceContraintesDual[j][i] = matriceContraintesPrimal[i][j];
-        }
+    if (solverDual.estInterrompu()) {
+        interrompu = true;
+        return;
     }
-    cout << "Matrice des contraintes dual: transposée de la matrice primal" << endl;
-
-    // 4. Termes de droite dual = fonction objectif primal
-    BiDual = fonctionObjectifPrimal;
-    cout << "Termes de droite dual: coefficients de la fonction objectif primal" << endl;
-
-    // 5. Types de contraintes dual (basé sur les types de variables primal)
-    typesContraintesDual.resize(n);
-    for (int j = 0; j < n; j++) {
-        if (typesVariablesPrimal[j] == NON_NEGATIVE) {
-            typesContraintesDual[j] = (typeObjPrimal == MAX) ? GEQ : LEQ;
-        } else if (typesVariablesPrimal[j] == NON_POSITIVE) {
-            typesContraintesDual[j] = (typeObjPrimal == MAX) ? LEQ : GEQ;
-        } else { // UNRESTRICTED
-            typesContraintesDual[j] = EQ;
-        }
-    }
-    cout << "Types de contraintes dual: basés sur les types de variables primal" << endl;
 
-    // 6. Types de variables dual (basé sur les types de contraintes primal)
-    typesVariablesDual.resize(m);
-    for (int i = 0; i < m; i++) {
-        if (typesContraintesPrimal[i] == LEQ) {
-            typesVariablesDual[i] = (typeObjPrimal == MAX) ? NON_NEGATIVE : NON_POSITIVE;
-        } else if (typesContraintesPrimal[i] == GEQ) {
-            typesVariablesDual[i] = (typeObjPrimal == MAX) ? NON_POSITIVE : NON_NEGATIVE;
-        } else { // EQ
-            typesVariablesDual[i] = UNRESTRICTED;
-        }
+    // Traduire l'état du dual en conclusion sur le primal
+    switch (solverDual.getEtatSolution()) {
+    case OPTIMALE:
+        // Dualité forte: les deux optimums coïncident
+        valeurObjectifDual = solverDual.getValeurObjectif();
+        valeurObjectifPrimal = valeurObjectifDual;
+        etatSolution = OPTIMALE;
+        extraireSolutionPrimalDepuisDual(solverDual);
+        break;
+    case NON_BORNE:
+        // Dual non borné => primal infaisable
+        etatSolution = INFAISABLE;
+        break;
+    default:
+        // Dual infaisable => primal infaisable OU non borné: pas de conclusion
+        journal() << "\nDual infaisable: le primal est soit non borne, soit infaisable.\n";
+        etatSolution = EN_COURS;
+        break;
     }
-    cout << "Types de variables dual: basés sur les types de contraintes primal" << endl;
 }
 
-void DualSimplexSolver::resoudreDualAvecSimplex() {
-    cout << "\n=== RESOLUTION DU PROBLEME DUAL PAR SIMPLEXE ===" << endl;
-
-    // Créer et résoudre le problème dual avec SimplexSolver
-    SimplexSolver solverDual(fonctionObjectifDual, matriceContraintesDual,
-                             BiDual, typesContraintesDual, typeObjDual, typesVariablesDual);
-
-    solverDual.solve();
+void DualSimplexSolver::extraireSolutionPrimalDepuisDual(const SimplexSolver& solverDual) {
+    journal() << "\n=== EXTRACTION DE LA SOLUTION PRIMALE DEPUIS LE DUAL ===" << endl;
+
+    // y* est la solution du dual. Écarts complémentaires: x_j ne peut
+    // être non nul que si la ligne duale j est serrée, et chaque ligne
+    // duale en base d'écart impose sa colonne. Sur la base optimale du
+    // dual, ce système se réduit à B^T x = c_B: x* = c_B B^-1 du dual,
+    // sans résoudre le primal
+    solutionDual = solverDual.getSolutionOptimale();
+    if (!solverDual.calculerValeursDuales(solutionPrimal)) {
+        // Base du dual non factorisable: x* par une résolution du primal,
+        // jamais d'optimum annoncé sans lui
+        journal() << "Base du dual non factorisable: x* par une resolution du primal." << endl;
+        SimplexSolver solverPrimal(*primal);
+        solverPrimal.setModeSilencieux(true);
+        solverPrimal.setDrapeauArret(drapeauArret);
+        solverPrimal.solve();
+        if (solverPrimal.estInterrompu()) {
+            interrompu = true;
+            return;
+        }
+        if (solverPrimal.getEtatSolution() != OPTIMALE) {
+            journal() << "Le primal ne confirme pas l'optimum du dual: pas de conclusion." << endl;
+            etatSolution = EN_COURS;
+            solutionPrimal.clear();
+            solutionDual.clear();
+            return;
+        }
+        solutionPrimal = solverPrimal.getSolutionOptimale();
+    }
 
-    // Extraire la solution duale
-    // Note: Nous n'avons pas accès direct aux solutions depuis SimplexSolver,
-    // donc nous devons capturer la sortie ou modifier SimplexSolver
-    // Pour l'instant, nous allons utiliser une approche simplifiée
+    verifierPaire();
+    probleme->replierValeursDuales(solutionDual);
 
-    // Cette partie nécessiterait d'étendre SimplexSolver pour exposer sa solution
-    // Pour la démonstration, nous allons résoudre et afficher les résultats
+    journal() << "x* = c_B B^-1 du dual (ecarts complementaires), y* = solution du dual" << endl;
+    journal() << "Ecart de dualite |c.x - b.y| = " << scientific << setprecision(3) << ecartDualite
+              << ", residu primal = " << residuPrimal << defaultfloat
+              << (dualiteVerifiee ? "  (paire verifiee)" : "  (ATTENTION: paire non verifiee)") << endl;
 }
 
-void DualSimplexSolver::extraireSolutionPrimalDepuisDual() {
-    // En théorie, la solution du dual donne les variables duales
-    // qui correspondent aux variables d'écart du primal, et vice versa
-    // Cette implémentation est simplifiée pour la démonstration
-
-    cout << "\n=== EXTRACTION DE LA SOLUTION PRIMALE DEPUIS LE DUAL ===" << endl;
-    cout << "Les variables duales optimales donnent la solution primale." << endl;
-    cout << "Les coûts réduits du dual donnent les variables d'écart du primal." << endl;
+void DualSimplexSolver::verifierPaire() {
+    ProblemeLineaire::ControlePaire controle = primal->controlerPaire(solutionPrimal, solutionDual, TOLERANCE_PAIRE);
+    valeurObjectifPrimal = controle.valeurPrimal;
+    valeurObjectifDual = controle.valeurDual;
+    residuPrimal = controle.residuPrimal;
+    ecartDualite = controle.ecartDualite;
+    dualiteVerifiee = controle.verifiee;
 }
 
 void DualSimplexSolver::solve() {
-    cout << "\n" << string(80, '=') << endl;
-    cout << "RESOLUTION PAR LA METHODE DU SIMPLEXE DUAL" << endl;
-    cout << string(80, '=') << "\n";
+    etatSolution = EN_COURS;
+    solutionPrimal.clear();
+    solutionDual.clear();
+    ecartDualite = 0.0;
+    residuPrimal = 0.0;
+    dualiteVerifiee = false;
+    interrompu = false;
+
+    journal() << "\n" << string(80, '=') << endl;
+    journal() << "RESOLUTION PAR LA METHODE DU SIMPLEXE DUAL" << endl;
+    journal() << string(80, '=') << "\n";
 
     // Afficher le problème primal
-    cout << "\n--- PROBLEME PRIMAL ---" << endl;
-    SimplexSolver solverPrimal(fonctionObjectifPrimal, matriceContraintesPrimal,
-                               BiPrimal, typesContraintesPrimal, typeObjPrimal, typesVariablesPrimal);
-    solverPrimal.afficherProbleme();
+    afficherProblemePrimal();
 
     // Transformer en dual
     transformerPrimalVersDual();
@@ -125,70 +142,129 @@ void DualSimplexSolver::solve() {
     // Afficher le problème dual
     afficherProblemeDual();
 
-    // Résoudre le dual
+    // Résoudre le dual, puis lire x* et y* sur sa base optimale
     resoudreDualAvecSimplex();
-
-    // Extraire la solution primale
-    extraireSolutionPrimalDepuisDual();
+    if (interrompu) return;
 
     // Afficher les résultats complets
     afficherResultatsComplets();
 }
 
+void DualSimplexSolver::afficherProblemePrimal() const {
+    if (modeSilencieux) return;
+
+    journal() << "\n--- PROBLEME PRIMAL ---\n\n";
+
+    journal() << (primal->typeObj == MAX ? "Maximiser" : "Minimiser") << " Z = ";
+    for (size_t j = 0; j < primal->fonctionObjectif.size(); j++) {
+        if (j > 0 && primal->fonctionObjectif[j] >= 0) journal() << " + ";
+        else if (j > 0) journal() << " ";
+        journal() << primal->fonctionObjectif[j] << "*x" << (j + 1);
+    }
+    journal() << "\n\nSous les contraintes:\n";
+
+    for (size_t i = 0; i < primal->matriceContraintes.size(); i++) {
+        journal() << "  ";
+        for (size_t j = 0; j < primal->matriceContraintes[i].size(); j++) {
+            if (j > 0 && primal->matriceContraintes[i][j] >= 0) journal() << " + ";
+            else if (j > 0) journal() << " ";
+            journal() << primal->matriceContraintes[i][j] << "*x" << (j + 1);
+        }
+
+        if (primal->typesContraintes[i] == LEQ) journal() << " <= ";
+        else if (primal->typesContraintes[i] == GEQ) journal() << " >= ";
+        else journal() << " = ";
+
+        journal() << primal->Bi[i] << endl;
+    }
+
+    journal() << "\n  Contraintes de signe:\n";
+    for (size_t j = 0; j < primal->typesVariables.size(); j++) {
+        journal() << "  x" << (j + 1) << " ";
+        if (primal->typesVariables[j] == NON_NEGATIVE) {
+            journal() << ">= 0";
+        } else if (primal->typesVariables[j] == NON_POSITIVE) {
+            journal() << "<= 0";
+        } else {
+            journal() << "s.r.s. (sans restriction de signe)";
+        }
+        journal() << endl;
+    }
+}
+
 void DualSimplexSolver::afficherProblemeDual() const {
-    cout << "\n--- PROBLEME DUAL ---\n\n";
+    journal() << "\n--- PROBLEME DUAL ---\n\n";
 
-    cout << (typeObjDual == MAX ? "Maximiser" : "Minimiser") << " W = ";
-    for (int i = 0; i < fonctionObjectifDual.size(); i++) {
-        if (i > 0 && fonctionObjectifDual[i] >= 0) cout << " + ";
-        else if (i > 0) cout << " ";
-        cout << fonctionObjectifDual[i] << "*y" << (i + 1);
+    int m = dual.getNbContraintes();
+    int n = dual.getNbVariables();
+
+    journal() << (dual.getTypeObjectif() == MAX ? "Maximiser" : "Minimiser") << " W = ";
+    for (int i = 0; i < n; i++) {
+        if (i > 0 && dual.coutVariable(i) >= 0) journal() << " + ";
+        else if (i > 0) journal() << " ";
+        journal() << dual.coutVariable(i) << "*y" << (i + 1);
     }
-    cout << "\n\nSous les contraintes:\n";
-
-    for (int i = 0; i < matriceContraintesDual.size(); i++) {
-        cout << "  ";
-        for (int j = 0; j < matriceContraintesDual[i].size(); j++) {
-            if (j > 0 && matriceContraintesDual[i][j] >= 0) cout << " + ";
-            else if (j > 0) cout << " ";
-            cout << matriceContraintesDual[i][j] << "*y" << (j + 1);
+    journal() << "\n\nSous les contraintes:\n";
+
+    for (int i = 0; i < m; i++) {
+        journal() << "  ";
+        for (int j = 0; j < n; j++) {
+            if (j > 0 && dual.coefficient(i, j) >= 0) journal() << " + ";
+            else if (j > 0) journal() << " ";
+            journal() << dual.coefficient(i, j) << "*y" << (j + 1);
         }
 
-        if (typesContraintesDual[i] == LEQ) cout << " <= ";
-        else if (typesContraintesDual[i] == GEQ) cout << " >= ";
-        else cout << " = ";
+        if (dual.typeContrainte(i) == LEQ) journal() << " <= ";
+        else if (dual.typeContrainte(i) == GEQ) journal() << " >= ";
+        else journal() << " = ";
 
-        cout << BiDual[i] << endl;
+        journal() << dual.secondMembre(i) << endl;
     }
 
-    cout << "\n  Contraintes de signe:\n";
-    for (int i = 0; i < typesVariablesDual.size(); i++) {
-        cout << "  y" << (i + 1) << " ";
-        if (typesVariablesDual[i] == NON_NEGATIVE) {
-            cout << ">= 0";
-        } else if (typesVariablesDual[i] == NON_POSITIVE) {
-            cout << "<= 0";
+    journal() << "\n  Contraintes de signe:\n";
+    for (int i = 0; i < n; i++) {
+        journal() << "  y" << (i + 1) << " ";
+        if (dual.typeVariable(i) == NON_NEGATIVE) {
+            journal() << ">= 0";
+        } else if (dual.typeVariable(i) == NON_POSITIVE) {
+            journal() << "<= 0";
         } else {
-            cout << "s.r.s. (sans restriction de signe)";
+            journal() << "s.r.s. (sans restriction de signe)";
         }
-        cout << endl;
+        journal() << endl;
     }
 }
 
 void DualSimplexSolver::afficherResultatsComplets() const {
-    cout << "\n" << string(80, '=') << endl;
-    cout << "RESULTATS COMPLETS PRIMAL-DUAL" << endl;
-    cout << string(80, '=') << "\n\n";
-
-    cout << "*** THEOREME DE DUALITE FORTE ***\n";
-    cout << "Si les deux problèmes ont des solutions optimales, alors:\n";
-    cout << "Valeur optimale du primal = Valeur optimale du dual\n\n";
+    journal() << "\n" << string(80, '=') << endl;
+    journal() << "RESULTATS COMPLETS PRIMAL-DUAL" << endl;
+    journal() << string(80, '=') << "\n\n";
+
+    journal() << "*** THEOREME DE DUALITE FORTE ***\n";
+    journal() << "Si les deux problèmes ont des solutions optimales, alors:\n";
+    journal() << "Valeur optimale du primal = Valeur optimale du dual\n\n";
+
+    if (etatSolution == OPTIMALE && !solutionPrimal.empty()) {
+        journal() << "Valeur optimale du primal c.x* = " << fixed << setprecision(4) << valeurObjectifPrimal << "\n";
+        journal() << "Valeur optimale du dual   b.y* = " << valeurObjectifDual << "\n\n";
+        journal() << "Solution primale:\n";
+        for (size_t j = 0; j < solutionPrimal.size(); j++) {
+            journal() << "  x" << (j + 1) << " = " << solutionPrimal[j] << "\n";
+        }
+        journal() << "Solution duale:\n";
+        for (size_t i = 0; i < solutionDual.size(); i++) {
+            journal() << "  y" << (i + 1) << " = " << solutionDual[i] << "\n";
+        }
+        journal() << defaultfloat << "\nEcart de dualite: " << scientific << setprecision(3) << ecartDualite
+                  << (dualiteVerifiee ? " (verifie)" : " (ATTENTION: au-dela de la tolerance)")
+                  << defaultfloat << "\n\n";
+    }
 
-    cout << "*** INTERPRETATION ECONOMIQUE ***\n";
-    cout << "Les variables duales y_i représentent les 'prix ombres' ou\n";
-    cout << "coûts marginaux des contraintes du problème primal.\n";
-    cout << "Elles indiquent de combien la fonction objectif s'améliorerait\n";
-    cout << "si la contrainte correspondante était relâchée d'une unité.\n";
+    journal() << "*** INTERPRETATION ECONOMIQUE ***\n";
+    journal() << "Les variables duales y_i représentent les 'prix ombres' ou\n";
+    journal() << "coûts marginaux des contraintes du problème primal.\n";
+    journal() << "Elles indiquent de combien la fonction objectif s'améliorerait\n";
+    journal() << "si la contrainte correspondante était relâchée d'une unité.\n";
 
-    cout << "\n" << string(80, '-') << endl;
+    journal() << "\n" << string(80, '-') << endl;
 }
@@ -4,56 +4,66 @@
 #include "simplexsolver.h"
 #include <vector>
 #include <string>
+#include <atomic>
+#include <ostream>
 
 class DualSimplexSolver {
 private:
-    // Problème primal original
-    std::vector<double> fonctionObjectifPrimal;
-    std::vector<std::vector<double>> matriceContraintesPrimal;
-    std::vector<double> BiPrimal;
-    std::vector<TypeContrainte> typesContraintesPrimal;
-    TypeObjectif typeObjPrimal;
-    std::vector<TypeVariable> typesVariablesPrimal;
-
-    // Problème dual
-    std::vector<double> fonctionObjectifDual;
-    std::vector<std::vector<double>> matriceContraintesDual;
-    std::vector<double> BiDual;
-    std::vector<TypeContrainte> typesContraintesDual;
-    TypeObjectif typeObjDual;
-    std::vector<TypeVariable> typesVariablesDual;
-
-    // Résultats
+    // Problème primal tel que saisi (partagé, jamais recopié) et sa forme
+    // résolue, copiée une fois seulement s'il a des lignes RANGE,
+    // développées en deux lignes
+    ProblemePartage probleme;
+    ProblemePartage primal;
+
+    // Problème dual: vue sur le stockage du primal, rien n'est recopié
+    VueProblemeLineaire dual;
+
+    // Résultats: x* et y* lus sur la même base optimale du dual
     std::vector<double> solutionPrimal;
-    std::vector<double> solutionDual;
-    double valeurObjectifPrimal;
-    double valeurObjectifDual;
+    std::vector<double> solutionDual;   // une valeur par contrainte saisie
+    double valeurObjectifPrimal;        // c.x*
+    double valeurObjectifDual;          // b.y*
     TypeSolution etatSolution;
 
-    const double EPSILON = 1e-10;
+    // Contrôle de la paire primal-dual
+    double ecartDualite;     // |c.x* - b.y*|
+    double residuPrimal;     // plus forte violation d'une contrainte ou d'un signe de x*
+    bool dualiteVerifiee;    // écart et résidu sous TOLERANCE_PAIRE (relative)
+
+    const double TOLERANCE_PAIRE = 1e-7;
 
+    bool modeSilencieux;
+    const std::atomic<bool>* drapeauArret;
+    bool interrompu;
+
+    std::ostream& journal() const { return fluxJournal(modeSilencieux); }
+
+    void afficherProblemePrimal() const;
     void transformerPrimalVersDual();
     void resoudreDualAvecSimplex();
-    void extraireSolutionPrimalDepuisDual();
+    void extraireSolutionPrimalDepuisDual(const SimplexSolver& solverDual);
+    void verifierPaire();
 
 public:
-    DualSimplexSolver(const std::vector<double>& fobj,
-                      const std::vector<std::vector<double>>& contraintes,
-                      const std::vector<double>& b,
-                      const std::vector<TypeContrainte>& types,
-                      TypeObjectif type,
-                      const std::vector<TypeVariable>& typesVar = std::vector<TypeVariable>());
+    explicit DualSimplexSolver(ProblemePartage probleme);
 
     void solve();
     void afficherProblemeDual() const;
     void afficherResultatsComplets() const;
 
+    void setModeSilencieux(bool silencieux) { modeSilencieux = silencieux; }
+    void setDrapeauArret(const std::atomic<bool>* drapeau) { drapeauArret = drapeau; }
+    bool estInterrompu() const { return interrompu; }
+
     // Getters pour l'interface
     std::vector<double> getSolutionPrimal() const { return solutionPrimal; }
     std::vector<double> getSolutionDual() const { return solutionDual; }
     double getValeurObjectifPrimal() const { return valeurObjectifPrimal; }
     double getValeurObjectifDual() const { return valeurObjectifDual; }
     TypeSolution getEtatSolution() const { return etatSolution; }
+    double getEcartDualite() const { return ecartDualite; }
+    double getResiduPrimal() const { return residuPrimal; }
+    bool estDualiteVerifiee() const { return dualiteVerifiee; }
 };
 
 #endif // DUALSIMPLEXSOLVER_H
@@ -0,0 +1,112 @@
+#ifndef FACTORISATIONLU_H
+#define FACTORISATIONLU_H
+
+#include "simplexsolver.h"
+#include <vector>
+#include <utility>
+
+//
+// Factorisation LU dense (pivot partiel) d'une matrice de base B.
+// Sert à refactoriser une base connue: résoudre B x = b et B^T y = c.
+//
+template<typename T>
+class FactorisationLU {
+private:
+    std::vector<std::vector<T>> lu;   // L (sous la diagonale, unité implicite) et U
+    std::vector<int> permutation;     // ligne de B utilisée à l'étape k
+    int taille;
+    bool singuliere;
+
+public:
+    FactorisationLU() : taille(0), singuliere(true) {}
+
+    bool factoriser(const std::vector<std::vector<T>>& B) {
+        taille = B.size();
+        lu = B;
+        permutation.resize(taille);
+        for (int i = 0; i < taille; i++) permutation[i] = i;
+        singuliere = false;
+
+        for (int k = 0; k < taille; k++) {
+            // Pivot partiel: plus grand |a_ik| pour i >= k
+            int lignePivot = k;
+            T maxVal = TraitsScalaire<T>::abs(lu[k][k]);
+            for (int i = k + 1; i < taille; i++) {
+                T val = TraitsScalaire<T>::abs(lu[i][k]);
+                if (val > maxVal) {
+                    maxVal = val;
+                    lignePivot = i;
+                }
+            }
+
+            if (!(maxVal > TraitsScalaire<T>::epsilon())) {
+                singuliere = true;
+                return false;
+            }
+
+            if (lignePivot != k) {
+                std::swap(lu[k], lu[lignePivot]);
+                std::swap(permutation[k], permutation[lignePivot]);
+            }
+
+            for (int i = k + 1; i < taille; i++) {
+                if (lu[i][k] == T(0)) continue;
+                T facteur = lu[i][k] / lu[k][k];
+                lu[i][k] = facteur;
+                for (int j = k + 1; j < taille; j++) {
+                    lu[i][j] -= facteur * lu[k][j];
+                }
+            }
+        }
+        return true;
+    }
+
+    bool estSinguliere() const { return singuliere; }
+
+    // Résout B x = b
+    std::vector<T> resoudre(const std::vector<T>& b) const {
+        std::vector<T> x(taille);
+        for (int i = 0; i < taille; i++) {
+            T somme = b[permutation[i]];
+            for (int j = 0; j < i; j++) {
+                somme -= lu[i][j] * x[j];
+            }
+            x[i] = somme;
+        }
+        for (int i = taille - 1; i >= 0; i--) {
+            T somme = x[i];
+            for (int j = i + 1; j < taille; j++) {
+                somme -= lu[i][j] * x[j];
+            }
+            x[i] = somme / lu[i][i];
+        }
+        return x;
+    }
+
+    // Résout B^T y = c
+    std::vector<T> resoudreTransposee(const std::vector<T>& c) const {
+        // U^T z = c
+        std::vector<T> z(taille);
+        for (int i = 0; i < taille; i++) {
+            T somme = c[i];
+            for (int j = 0; j < i; j++) {
+                somme -= lu[j][i] * z[j];
+            }
+            z[i] = somme / lu[i][i];
+        }
+        // L^T w = z
+        for (int i = taille - 1; i >= 0; i--) {
+            for (int j = i + 1; j < taille; j++) {
+                z[i] -= lu[j][i] * z[j];
+            }
+        }
+        // y = P^T w
+        std::vector<T> y(taille);
+        for (int i = 0; i < taille; i++) {
+            y[permutation[i]] = z[i];
+        }
+        return y;
+    }
+};
+
+#endif // FACTORISATIONLU_H
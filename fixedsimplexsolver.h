@@ -0,0 +1,322 @@
+#ifndef FIXEDSIMPLEXSOLVER_H
+#define FIXEDSIMPLEXSOLVER_H
+
+#include "simplexsolver.h"
+#include <array>
+
+//
+// Simplexe à deux phases pour les petits problèmes de taille connue à la
+// compilation (l'interface plafonne à 10 variables x 10 contraintes).
+// Le tableau vit dans des std::array: aucune allocation, aucune trace,
+// et toutes les bornes de boucles sont des constantes de compilation.
+// Tout le calcul est constexpr: un problème connu à la compilation peut
+// être résolu par le compilateur (voir solve(ProblemeFixe) plus bas).
+//
+// Disposition fixe des colonnes:
+//   [0, N)            x_j (ou -x_j si NON_POSITIVE)
+//   [N, 2N)           partie négative x_j- (UNRESTRICTED seulement)
+//   [2N, 2N+M)        variable d'écart / d'excédent de la ligne i
+//   [2N+M, 2N+2M)     variable artificielle de la ligne i
+// Les colonnes inutilisées restent nulles et sont marquées inactives.
+// Lignes LEQ, GEQ et EQ seulement: une ligne RANGE demande une borne
+// inférieure que ce format n'a pas (voir SimplexSolver).
+//
+template<int M, int N>
+class FixedSimplexSolver {
+public:
+    static constexpr int NB_COLONNES = 2 * N + 2 * M;
+    static constexpr int COLONNE_B = NB_COLONNES;
+    static constexpr int LIGNE_OBJECTIF = M;
+
+private:
+    std::array<double, N> fonctionObjectif;
+    TypeObjectif typeObj;
+    std::array<TypeVariable, N> typesVariables;
+
+    std::array<std::array<double, NB_COLONNES + 1>, M + 1> tableau;
+    std::array<int, M> base;
+    std::array<bool, NB_COLONNES> colonneActive;
+    std::array<bool, NB_COLONNES> estArtificielle;
+
+    TypeSolution etatSolution;
+    double valeurObjectif;
+    std::array<double, N> solutionOptimale;
+    int nbIterations;
+    bool dernierPivotDegenere;
+
+    static constexpr double EPSILON = 1e-10;
+
+    // std::fabs n'est pas constexpr en C++17
+    static constexpr double valeurAbsolue(double v) { return v < 0 ? -v : v; }
+
+    static constexpr std::array<TypeVariable, N> toutesNonNegatives() {
+        std::array<TypeVariable, N> types{};
+        for (int j = 0; j < N; j++) types[j] = NON_NEGATIVE;
+        return types;
+    }
+
+    // Colonne entrante: Dantzig (coût réduit le plus négatif); après un
+    // pivot dégénéré, règle de Bland (plus petit indice) contre le cyclage
+    constexpr int trouverColonnePivot() const {
+        int colPivot = -1;
+        double plusNegatif = -EPSILON;
+        for (int j = 0; j < NB_COLONNES; j++) {
+            if (!colonneActive[j]) continue;
+            double d = tableau[LIGNE_OBJECTIF][j];
+            if (d < plusNegatif) {
+                colPivot = j;
+                if (dernierPivotDegenere) break;
+                plusNegatif = d;
+            }
+        }
+        return colPivot;
+    }
+
+    // Test du rapport minimal; égalités départagées par le plus petit
+    // indice de variable de base. -1 si la colonne est non bornée.
+    constexpr int trouverLignePivot(int colPivot) const {
+        int lignePivot = -1;
+        double rapportMin = 0;
+        for (int i = 0; i < M; i++) {
+            double a = tableau[i][colPivot];
+            if (a <= EPSILON) continue;
+            double rapport = tableau[i][COLONNE_B] / a;
+            if (lignePivot == -1 || rapport < rapportMin - EPSILON ||
+                (rapport <= rapportMin + EPSILON && base[i] < base[lignePivot])) {
+                lignePivot = i;
+                rapportMin = rapport;
+            }
+        }
+        return lignePivot;
+    }
+
+    constexpr void pivoter(int lignePivot, int colPivot) {
+        double pivot = tableau[lignePivot][colPivot];
+        dernierPivotDegenere = valeurAbsolue(tableau[lignePivot][COLONNE_B]) <= EPSILON;
+
+        for (int j = 0; j <= NB_COLONNES; j++) {
+            tableau[lignePivot][j] /= pivot;
+        }
+        for (int i = 0; i <= M; i++) {
+            if (i == lignePivot) continue;
+            double facteur = tableau[i][colPivot];
+            if (facteur == 0) continue;
+            for (int j = 0; j <= NB_COLONNES; j++) {
+                tableau[i][j] -= facteur * tableau[lignePivot][j];
+            }
+        }
+        base[lignePivot] = colPivot;
+        nbIterations++;
+    }
+
+    // Itérations jusqu'à l'optimalité; false si une colonne est non bornée
+    constexpr bool iterer() {
+        dernierPivotDegenere = false;
+        while (true) {
+            int colPivot = trouverColonnePivot();
+            if (colPivot == -1) return true;
+
+            int lignePivot = trouverLignePivot(colPivot);
+            if (lignePivot == -1) return false;
+
+            pivoter(lignePivot, colPivot);
+        }
+    }
+
+    constexpr void initialiserTableau(const std::array<std::array<double, N>, M>& contraintes,
+                            const std::array<double, M>& b,
+                            const std::array<TypeContrainte, M>& types) {
+        for (auto& ligne : tableau) {
+            for (double& v : ligne) v = 0;
+        }
+        for (int j = 0; j < NB_COLONNES; j++) {
+            colonneActive[j] = false;
+            estArtificielle[j] = j >= 2 * N + M;
+        }
+
+        for (int j = 0; j < N; j++) {
+            colonneActive[j] = true;
+            colonneActive[N + j] = typesVariables[j] == UNRESTRICTED;
+        }
+
+        for (int i = 0; i < M; i++) {
+            // Ligne ramenée à un second membre positif
+            double signe = b[i] < 0 ? -1.0 : 1.0;
+            TypeContrainte type = types[i];
+            if (signe < 0 && type != EQ) type = (type == LEQ) ? GEQ : LEQ;
+
+            for (int j = 0; j < N; j++) {
+                double a = signe * contraintes[i][j];
+                if (typesVariables[j] == NON_POSITIVE) a = -a;
+                tableau[i][j] = a;
+                if (typesVariables[j] == UNRESTRICTED) tableau[i][N + j] = -a;
+            }
+            tableau[i][COLONNE_B] = signe * b[i];
+
+            int ecart = 2 * N + i;
+            int artificielle = 2 * N + M + i;
+            if (type == LEQ) {
+                tableau[i][ecart] = 1;
+                colonneActive[ecart] = true;
+                base[i] = ecart;
+            } else {
+                if (type == GEQ) {
+                    tableau[i][ecart] = -1;
+                    colonneActive[ecart] = true;
+                }
+                tableau[i][artificielle] = 1;
+                colonneActive[artificielle] = true;
+                base[i] = artificielle;
+            }
+        }
+    }
+
+    // Phase 1: MIN W = somme des artificielles
+    constexpr bool phase1() {
+        for (int j = 0; j <= NB_COLONNES; j++) {
+            tableau[LIGNE_OBJECTIF][j] = 0;
+        }
+        bool aDesArtificielles = false;
+        for (int i = 0; i < M; i++) {
+            if (!estArtificielle[base[i]]) continue;
+            aDesArtificielles = true;
+            for (int j = 0; j < 2 * N + M; j++) {
+                tableau[LIGNE_OBJECTIF][j] -= tableau[i][j];
+            }
+            tableau[LIGNE_OBJECTIF][COLONNE_B] -= tableau[i][COLONNE_B];
+        }
+        if (!aDesArtificielles) return true;
+
+        iterer();
+        if (-tableau[LIGNE_OBJECTIF][COLONNE_B] > EPSILON) return false;
+
+        // Artificielles restées en base au niveau zéro: pivot dégénéré sur
+        // une colonne structurelle; sinon la ligne est redondante
+        for (int i = 0; i < M; i++) {
+            if (!estArtificielle[base[i]]) continue;
+            for (int j = 0; j < 2 * N + M; j++) {
+                if (colonneActive[j] && valeurAbsolue(tableau[i][j]) > EPSILON) {
+                    pivoter(i, j);
+                    break;
+                }
+            }
+        }
+        for (int j = 2 * N + M; j < NB_COLONNES; j++) {
+            colonneActive[j] = false;
+        }
+        return true;
+    }
+
+    // Phase 2: MIN du coût transformé (MAX -> MIN -c)
+    constexpr bool phase2() {
+        std::array<double, NB_COLONNES> couts{};
+        for (int j = 0; j < N; j++) {
+            double c = (typeObj == MAX) ? -fonctionObjectif[j] : fonctionObjectif[j];
+            if (typesVariables[j] == NON_POSITIVE) c = -c;
+            couts[j] = c;
+            if (typesVariables[j] == UNRESTRICTED) couts[N + j] = -c;
+        }
+
+        for (int j = 0; j < NB_COLONNES; j++) {
+            tableau[LIGNE_OBJECTIF][j] = couts[j];
+        }
+        tableau[LIGNE_OBJECTIF][COLONNE_B] = 0;
+        for (int i = 0; i < M; i++) {
+            double cB = couts[base[i]];
+            if (cB == 0) continue;
+            for (int j = 0; j <= NB_COLONNES; j++) {
+                tableau[LIGNE_OBJECTIF][j] -= cB * tableau[i][j];
+            }
+        }
+
+        return iterer();
+    }
+
+    constexpr void extraireSolution() {
+        std::array<double, NB_COLONNES> valeurs{};
+        for (int i = 0; i < M; i++) {
+            valeurs[base[i]] = tableau[i][COLONNE_B];
+        }
+
+        valeurObjectif = 0;
+        for (int j = 0; j < N; j++) {
+            double x = valeurs[j];
+            if (typesVariables[j] == NON_POSITIVE) x = -x;
+            if (typesVariables[j] == UNRESTRICTED) x -= valeurs[N + j];
+            solutionOptimale[j] = x;
+            valeurObjectif += fonctionObjectif[j] * x;
+        }
+    }
+
+public:
+    constexpr FixedSimplexSolver(const std::array<double, N>& fobj,
+                       const std::array<std::array<double, N>, M>& contraintes,
+                       const std::array<double, M>& b,
+                       const std::array<TypeContrainte, M>& types,
+                       TypeObjectif type,
+                       const std::array<TypeVariable, N>& typesVar = toutesNonNegatives())
+        : fonctionObjectif(fobj), typeObj(type), typesVariables(typesVar),
+        tableau{}, base{}, colonneActive{}, estArtificielle{},
+        etatSolution(EN_COURS), valeurObjectif(0), solutionOptimale{},
+        nbIterations(0), dernierPivotDegenere(false) {
+        initialiserTableau(contraintes, b, types);
+    }
+
+    constexpr void solve() {
+        if (!phase1()) {
+            etatSolution = INFAISABLE;
+            return;
+        }
+        if (!phase2()) {
+            etatSolution = NON_BORNE;
+            return;
+        }
+        extraireSolution();
+        etatSolution = OPTIMALE;
+    }
+
+    constexpr TypeSolution getEtatSolution() const { return etatSolution; }
+    constexpr double getValeurObjectif() const { return valeurObjectif; }
+    constexpr const std::array<double, N>& getSolutionOptimale() const { return solutionOptimale; }
+    constexpr int getNbIterations() const { return nbIterations; }
+};
+
+//
+// Problème et solution sous forme d'agrégats littéraux, pour la résolution
+// à la compilation:
+//
+//   constexpr ProblemeFixe<3, 2> probleme = {
+//       {3, 5}, {{{1, 0}, {0, 2}, {3, 2}}}, {4, 12, 18}, {LEQ, LEQ, LEQ}, MAX,
+//       {NON_NEGATIVE, NON_NEGATIVE}};
+//   static constexpr auto sol = solve(probleme);
+//   static_assert(sol.etat == OPTIMALE, "probleme infaisable ou non borne");
+//
+template<int M, int N>
+struct ProblemeFixe {
+    std::array<double, N> fonctionObjectif;
+    std::array<std::array<double, N>, M> matriceContraintes;
+    std::array<double, M> Bi;
+    std::array<TypeContrainte, M> typesContraintes;
+    TypeObjectif typeObj;
+    std::array<TypeVariable, N> typesVariables;   // NON_NEGATIVE par défaut
+};
+
+template<int N>
+struct SolutionFixe {
+    TypeSolution etat;
+    double valeurObjectif;
+    std::array<double, N> x;
+    int nbIterations;
+};
+
+template<int M, int N>
+constexpr SolutionFixe<N> solve(const ProblemeFixe<M, N>& probleme) {
+    FixedSimplexSolver<M, N> solver(probleme.fonctionObjectif, probleme.matriceContraintes,
+                                    probleme.Bi, probleme.typesContraintes,
+                                    probleme.typeObj, probleme.typesVariables);
+    solver.solve();
+    return SolutionFixe<N>{solver.getEtatSolution(), solver.getValeurObjectif(),
+                           solver.getSolutionOptimale(), solver.getNbIterations()};
+}
+
+#endif // FIXEDSIMPLEXSOLVER_H
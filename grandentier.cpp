@@ -0,0 +1,325 @@
+#include "grandentier.h"
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+GrandEntier::GrandEntier(int64_t valeur) {
+    negatif = valeur < 0;
+    // -(valeur + 1) + 1 évite le débordement pour INT64_MIN
+    uint64_t magnitude = negatif ? static_cast<uint64_t>(-(valeur + 1)) + 1 : static_cast<uint64_t>(valeur);
+    while (magnitude != 0) {
+        chiffres.push_back(static_cast<uint32_t>(magnitude));
+        magnitude >>= 32;
+    }
+}
+
+GrandEntier::GrandEntier(__int128 valeur) {
+    negatif = valeur < 0;
+    unsigned __int128 magnitude = negatif ? static_cast<unsigned __int128>(-(valeur + 1)) + 1
+                                          : static_cast<unsigned __int128>(valeur);
+    while (magnitude != 0) {
+        chiffres.push_back(static_cast<uint32_t>(magnitude));
+        magnitude >>= 32;
+    }
+}
+
+void GrandEntier::normaliser() {
+    while (!chiffres.empty() && chiffres.back() == 0) {
+        chiffres.pop_back();
+    }
+    if (chiffres.empty()) negatif = false;
+}
+
+bool GrandEntier::tientSur64Bits() const {
+    if (chiffres.size() <= 1) return true;
+    if (chiffres.size() > 2) return false;
+    uint64_t magnitude = (static_cast<uint64_t>(chiffres[1]) << 32) | chiffres[0];
+    return negatif ? magnitude <= (static_cast<uint64_t>(1) << 63)
+                   : magnitude < (static_cast<uint64_t>(1) << 63);
+}
+
+int64_t GrandEntier::versInt64() const {
+    uint64_t magnitude = 0;
+    for (int i = static_cast<int>(chiffres.size()) - 1; i >= 0; i--) {
+        magnitude = (magnitude << 32) | chiffres[i];
+    }
+    if (!negatif) return static_cast<int64_t>(magnitude);
+    return static_cast<int64_t>(~magnitude + 1);
+}
+
+double GrandEntier::versDouble(int& exposant) const {
+    // Trois chiffres de poids fort suffisent pour les 53 bits du double
+    int n = chiffres.size();
+    int debut = max(0, n - 3);
+    double mantisse = 0.0;
+    for (int i = n - 1; i >= debut; i--) {
+        mantisse = mantisse * 4294967296.0 + chiffres[i];
+    }
+    exposant = 32 * debut;
+    return negatif ? -mantisse : mantisse;
+}
+
+GrandEntier GrandEntier::operator-() const {
+    GrandEntier resultat = *this;
+    if (!resultat.chiffres.empty()) resultat.negatif = !negatif;
+    return resultat;
+}
+
+GrandEntier GrandEntier::abs() const {
+    GrandEntier resultat = *this;
+    resultat.negatif = false;
+    return resultat;
+}
+
+GrandEntier GrandEntier::decalerGauche(int bits) const {
+    if (chiffres.empty() || bits == 0) return *this;
+    GrandEntier resultat;
+    resultat.negatif = negatif;
+    int mots = bits / 32, reste = bits % 32;
+    resultat.chiffres.assign(mots, 0);
+    uint32_t retenue = 0;
+    for (uint32_t c : chiffres) {
+        if (reste == 0) {
+            resultat.chiffres.push_back(c);
+        } else {
+            resultat.chiffres.push_back((c << reste) | retenue);
+            retenue = c >> (32 - reste);
+        }
+    }
+    if (retenue != 0) resultat.chiffres.push_back(retenue);
+    return resultat;
+}
+
+int GrandEntier::comparerMagnitude(const vector<uint32_t>& a, const vector<uint32_t>& b) {
+    if (a.size() != b.size()) return a.size() < b.size() ? -1 : 1;
+    for (int i = static_cast<int>(a.size()) - 1; i >= 0; i--) {
+        if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+vector<uint32_t> GrandEntier::ajouterMagnitude(const vector<uint32_t>& a, const vector<uint32_t>& b) {
+    const vector<uint32_t>& grand = a.size() >= b.size() ? a : b;
+    const vector<uint32_t>& petit = a.size() >= b.size() ? b : a;
+    vector<uint32_t> resultat(grand.size() + 1);
+    uint64_t retenue = 0;
+    for (size_t i = 0; i < grand.size(); i++) {
+        uint64_t somme = static_cast<uint64_t>(grand[i]) + (i < petit.size() ? petit[i] : 0) + retenue;
+        resultat[i] = static_cast<uint32_t>(somme);
+        retenue = somme >> 32;
+    }
+    resultat[grand.size()] = static_cast<uint32_t>(retenue);
+    return resultat;
+}
+
+// Suppose |a| >= |b|
+vector<uint32_t> GrandEntier::soustraireMagnitude(const vector<uint32_t>& a, const vector<uint32_t>& b) {
+    vector<uint32_t> resultat(a.size());
+    int64_t emprunt = 0;
+    for (size_t i = 0; i < a.size(); i++) {
+        int64_t diff = static_cast<int64_t>(a[i]) - (i < b.size() ? b[i] : 0) - emprunt;
+        emprunt = diff < 0 ? 1 : 0;
+        resultat[i] = static_cast<uint32_t>(diff + (emprunt << 32));
+    }
+    return resultat;
+}
+
+vector<uint32_t> GrandEntier::multiplierMagnitude(const vector<uint32_t>& a, const vector<uint32_t>& b) {
+    if (a.empty() || b.empty()) return vector<uint32_t>();
+    vector<uint32_t> resultat(a.size() + b.size(), 0);
+    for (size_t i = 0; i < a.size(); i++) {
+        uint64_t retenue = 0;
+        for (size_t j = 0; j < b.size(); j++) {
+            uint64_t produit = static_cast<uint64_t>(a[i]) * b[j] + resultat[i + j] + retenue;
+            resultat[i + j] = static_cast<uint32_t>(produit);
+            retenue = produit >> 32;
+        }
+        resultat[i + b.size()] = static_cast<uint32_t>(retenue);
+    }
+    return resultat;
+}
+
+// Division longue de Knuth (algorithme D), b non nul
+void GrandEntier::diviserMagnitude(const vector<uint32_t>& a, const vector<uint32_t>& b,
+                                   vector<uint32_t>& quotient, vector<uint32_t>& reste) {
+    const uint64_t BASE = static_cast<uint64_t>(1) << 32;
+
+    if (comparerMagnitude(a, b) < 0) {
+        quotient.clear();
+        reste = a;
+        return;
+    }
+
+    int m = a.size(), n = b.size();
+    quotient.assign(m - n + 1, 0);
+
+    if (n == 1) {
+        uint64_t r = 0;
+        for (int j = m - 1; j >= 0; j--) {
+            uint64_t courant = (r << 32) | a[j];
+            quotient[j] = static_cast<uint32_t>(courant / b[0]);
+            r = courant % b[0];
+        }
+        reste.assign(1, static_cast<uint32_t>(r));
+        return;
+    }
+
+    // Normalisation: le chiffre de tête du diviseur a son bit fort à 1
+    int s = 0;
+    uint32_t tete = b[n - 1];
+    while ((tete & 0x80000000u) == 0) {
+        tete <<= 1;
+        s++;
+    }
+
+    vector<uint32_t> vn(n), un(m + 1);
+    for (int i = n - 1; i > 0; i--) {
+        vn[i] = s == 0 ? b[i] : (b[i] << s) | (b[i - 1] >> (32 - s));
+    }
+    vn[0] = b[0] << s;
+    un[m] = s == 0 ? 0 : a[m - 1] >> (32 - s);
+    for (int i = m - 1; i > 0; i--) {
+        un[i] = s == 0 ? a[i] : (a[i] << s) | (a[i - 1] >> (32 - s));
+    }
+    un[0] = a[0] << s;
+
+    for (int j = m - n; j >= 0; j--) {
+        uint64_t numerateur = (static_cast<uint64_t>(un[j + n]) << 32) | un[j + n - 1];
+        uint64_t qhat = numerateur / vn[n - 1];
+        uint64_t rhat = numerateur % vn[n - 1];
+
+        while (qhat >= BASE || qhat * vn[n - 2] > ((rhat << 32) | un[j + n - 2])) {
+            qhat--;
+            rhat += vn[n - 1];
+            if (rhat >= BASE) break;
+        }
+
+        // Multiplier et soustraire
+        int64_t t;
+        int64_t k = 0;
+        for (int i = 0; i < n; i++) {
+            uint64_t p = qhat * vn[i];
+            t = static_cast<int64_t>(un[i + j]) - k - static_cast<int64_t>(p & 0xFFFFFFFFu);
+            un[i + j] = static_cast<uint32_t>(t);
+            k = static_cast<int64_t>(p >> 32) - (t >> 32);
+        }
+        t = static_cast<int64_t>(un[j + n]) - k;
+        un[j + n] = static_cast<uint32_t>(t);
+
+        quotient[j] = static_cast<uint32_t>(qhat);
+        if (t < 0) {
+            // Rajouter le diviseur une fois
+            quotient[j]--;
+            uint64_t retenue = 0;
+            for (int i = 0; i < n; i++) {
+                uint64_t somme = static_cast<uint64_t>(un[i + j]) + vn[i] + retenue;
+                un[i + j] = static_cast<uint32_t>(somme);
+                retenue = somme >> 32;
+            }
+            un[j + n] = static_cast<uint32_t>(un[j + n] + retenue);
+        }
+    }
+
+    reste.assign(n, 0);
+    for (int i = 0; i < n; i++) {
+        reste[i] = s == 0 ? un[i] : (un[i] >> s) | (un[i + 1] << (32 - s));
+    }
+}
+
+GrandEntier operator+(const GrandEntier& a, const GrandEntier& b) {
+    GrandEntier resultat;
+    if (a.negatif == b.negatif) {
+        resultat.chiffres = GrandEntier::ajouterMagnitude(a.chiffres, b.chiffres);
+        resultat.negatif = a.negatif;
+    } else if (GrandEntier::comparerMagnitude(a.chiffres, b.chiffres) >= 0) {
+        resultat.chiffres = GrandEntier::soustraireMagnitude(a.chiffres, b.chiffres);
+        resultat.negatif = a.negatif;
+    } else {
+        resultat.chiffres = GrandEntier::soustraireMagnitude(b.chiffres, a.chiffres);
+        resultat.negatif = b.negatif;
+    }
+    resultat.normaliser();
+    return resultat;
+}
+
+GrandEntier operator-(const GrandEntier& a, const GrandEntier& b) {
+    return a + (-b);
+}
+
+GrandEntier operator*(const GrandEntier& a, const GrandEntier& b) {
+    GrandEntier resultat;
+    resultat.chiffres = GrandEntier::multiplierMagnitude(a.chiffres, b.chiffres);
+    resultat.negatif = a.negatif != b.negatif;
+    resultat.normaliser();
+    return resultat;
+}
+
+GrandEntier operator/(const GrandEntier& a, const GrandEntier& b) {
+    if (b.estZero()) throw domain_error("GrandEntier: division par zero");
+    GrandEntier quotient, reste;
+    GrandEntier::diviserMagnitude(a.chiffres, b.chiffres, quotient.chiffres, reste.chiffres);
+    quotient.negatif = a.negatif != b.negatif;
+    quotient.normaliser();
+    return quotient;
+}
+
+GrandEntier operator%(const GrandEntier& a, const GrandEntier& b) {
+    if (b.estZero()) throw domain_error("GrandEntier: division par zero");
+    GrandEntier quotient, reste;
+    GrandEntier::diviserMagnitude(a.chiffres, b.chiffres, quotient.chiffres, reste.chiffres);
+    reste.negatif = a.negatif;
+    reste.normaliser();
+    return reste;
+}
+
+int comparer(const GrandEntier& a, const GrandEntier& b) {
+    if (a.negatif != b.negatif) return a.negatif ? -1 : 1;
+    int c = GrandEntier::comparerMagnitude(a.chiffres, b.chiffres);
+    return a.negatif ? -c : c;
+}
+
+bool operator==(const GrandEntier& a, const GrandEntier& b) {
+    return a.negatif == b.negatif && a.chiffres == b.chiffres;
+}
+
+bool operator<(const GrandEntier& a, const GrandEntier& b) {
+    return comparer(a, b) < 0;
+}
+
+GrandEntier GrandEntier::pgcd(GrandEntier a, GrandEntier b) {
+    a = a.abs();
+    b = b.abs();
+    while (!b.estZero()) {
+        GrandEntier r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+string GrandEntier::versChaine() const {
+    if (chiffres.empty()) return "0";
+
+    // Divisions successives par 10^9
+    vector<uint32_t> courant = chiffres;
+    vector<uint32_t> blocs;
+    while (!courant.empty()) {
+        uint64_t r = 0;
+        for (int i = static_cast<int>(courant.size()) - 1; i >= 0; i--) {
+            uint64_t valeur = (r << 32) | courant[i];
+            courant[i] = static_cast<uint32_t>(valeur / 1000000000u);
+            r = valeur % 1000000000u;
+        }
+        blocs.push_back(static_cast<uint32_t>(r));
+        while (!courant.empty() && courant.back() == 0) courant.pop_back();
+    }
+
+    string resultat = negatif ? "-" : "";
+    resultat += to_string(blocs.back());
+    for (int i = static_cast<int>(blocs.size()) - 2; i >= 0; i--) {
+        string bloc = to_string(blocs[i]);
+        resultat += string(9 - bloc.size(), '0') + bloc;
+    }
+    return resultat;
+}
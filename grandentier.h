@@ -0,0 +1,61 @@
+#ifndef GRANDENTIER_H
+#define GRANDENTIER_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+//
+// Entier signé en précision arbitraire (signe + magnitude, chiffres en
+// base 2^32, poids faible en tête). Utilisé par Rationnel lorsque les
+// valeurs ne tiennent plus sur 64 bits.
+//
+class GrandEntier {
+private:
+    std::vector<uint32_t> chiffres;   // magnitude, sans zéros de tête
+    bool negatif;
+
+    void normaliser();
+
+    static int comparerMagnitude(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+    static std::vector<uint32_t> ajouterMagnitude(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+    static std::vector<uint32_t> soustraireMagnitude(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+    static std::vector<uint32_t> multiplierMagnitude(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b);
+    static void diviserMagnitude(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b,
+                                 std::vector<uint32_t>& quotient, std::vector<uint32_t>& reste);
+
+public:
+    GrandEntier() : negatif(false) {}
+    GrandEntier(int64_t valeur);
+    explicit GrandEntier(__int128 valeur);
+
+    bool estZero() const { return chiffres.empty(); }
+    bool estNegatif() const { return negatif; }
+    int signe() const { return chiffres.empty() ? 0 : (negatif ? -1 : 1); }
+    int nbChiffres() const { return chiffres.size(); }
+
+    bool tientSur64Bits() const;
+    int64_t versInt64() const;            // suppose tientSur64Bits()
+    double versDouble(int& exposant) const;  // valeur = mantisse * 2^exposant
+
+    GrandEntier operator-() const;
+    GrandEntier abs() const;
+    GrandEntier decalerGauche(int bits) const;
+
+    friend GrandEntier operator+(const GrandEntier& a, const GrandEntier& b);
+    friend GrandEntier operator-(const GrandEntier& a, const GrandEntier& b);
+    friend GrandEntier operator*(const GrandEntier& a, const GrandEntier& b);
+    // Division tronquée vers zéro (comme pour les entiers C++)
+    friend GrandEntier operator/(const GrandEntier& a, const GrandEntier& b);
+    friend GrandEntier operator%(const GrandEntier& a, const GrandEntier& b);
+
+    friend bool operator==(const GrandEntier& a, const GrandEntier& b);
+    friend bool operator<(const GrandEntier& a, const GrandEntier& b);
+    friend int comparer(const GrandEntier& a, const GrandEntier& b);
+
+    static GrandEntier pgcd(GrandEntier a, GrandEntier b);
+
+    std::string versChaine() const;
+};
+
+#endif // GRANDENTIER_H
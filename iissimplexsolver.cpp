@@ -0,0 +1,223 @@
+#include "iissimplexsolver.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+IisSimplexSolver::IisSimplexSolver(ProblemePartage problemePartage)
+    : probleme(std::move(problemePartage)) {
+
+    etatSolution = EN_COURS;
+    nbLignesSupport = 0;
+    nbTests = 0;
+    nbIterations = 0;
+    unitesTravail = 0;
+
+    modeSilencieux = false;
+}
+
+ProblemePartage IisSimplexSolver::construireModeleElastique(const vector<int>& lignes,
+                                                            vector<int>& premiereViolation) const {
+    const ProblemeLineaire& p = *probleme;
+    int n = p.fonctionObjectif.size();
+
+    int nbViolations = 0;
+    for (int i : lignes) {
+        nbViolations += (p.typesContraintes[i] == EQ || p.typesContraintes[i] == RANGE) ? 2 : 1;
+    }
+    int largeur = n + nbViolations;
+
+    // Min sum e: les variables d'origine ne coûtent rien
+    vector<double> fobj(n, 0.0);
+    fobj.resize(largeur, 1.0);
+    vector<TypeVariable> typesVar(p.typesVariables);
+    typesVar.resize(largeur, NON_NEGATIVE);
+
+    vector<vector<double>> contraintes;
+    vector<double> b, bornesInf;
+    vector<TypeContrainte> types;
+    premiereViolation.clear();
+    int e = n;
+    for (int i : lignes) {
+        vector<double> ligne(largeur, 0.0);
+        copy(p.matriceContraintes[i].begin(), p.matriceContraintes[i].end(), ligne.begin());
+
+        // e relâche la ligne dans chaque sens où elle peut bloquer
+        TypeContrainte type = p.typesContraintes[i];
+        premiereViolation.push_back(e);
+        if (type == LEQ) {
+            ligne[e++] = -1.0;
+        } else if (type == GEQ) {
+            ligne[e++] = 1.0;
+        } else {
+            ligne[e++] = 1.0;
+            ligne[e++] = -1.0;
+        }
+
+        contraintes.push_back(std::move(ligne));
+        b.push_back(p.Bi[i]);
+        types.push_back(type);
+        bornesInf.push_back(type == RANGE ? p.bornesInferieures[i] : 0.0);
+    }
+
+    return ProblemeLineaire::creer(std::move(fobj), std::move(contraintes), std::move(b), std::move(types),
+                                   MIN, std::move(typesVar), std::move(bornesInf));
+}
+
+bool IisSimplexSolver::filtrer(const vector<int>& lignes) {
+    const ProblemeLineaire& p = *probleme;
+
+    vector<int> premiereViolation;
+    ProblemePartage modele = construireModeleElastique(lignes, premiereViolation);
+    SimplexSolver elastique(*modele);
+    elastique.setModeSilencieux(true);
+    elastique.solve();
+    nbIterations += elastique.getNbIterations();
+    unitesTravail += elastique.getUnitesTravail();
+
+    double echelle = 1.0;
+    for (int i : lignes) {
+        echelle = max(echelle, fabs(p.Bi[i]));
+        if (p.typesContraintes[i] == RANGE) echelle = max(echelle, fabs(p.bornesInferieures[i]));
+    }
+    double seuil = SEUIL_VIOLATION * echelle;
+    auto infaisable = [&]() {
+        return elastique.getEtatSolution() == OPTIMALE && elastique.getValeurObjectif() > seuil;
+    };
+
+    // Le poids d'une ligne porte sur toutes ses variables de violation
+    auto fixerPoids = [&](int k, double poids) {
+        elastique.setCoutVariable(premiereViolation[k], poids);
+        TypeContrainte type = p.typesContraintes[lignes[k]];
+        if (type == EQ || type == RANGE) elastique.setCoutVariable(premiereViolation[k] + 1, poids);
+    };
+
+    bool resultat = infaisable();
+    if (resultat) {
+        int nbLignes = lignes.size();
+        nbLignesSupport = nbLignes;
+        vector<bool> retenue(nbLignes, true);
+
+        // Une ligne nécessaire reprend son poids au test suivant: une
+        // seule réoptimisation par ligne
+        int aReprendre = -1;
+        for (int k = 0; k < nbLignes; k++) {
+            if (aReprendre != -1) fixerPoids(aReprendre, 1.0);
+            fixerPoids(k, 0.0);
+            elastique.reoptimiser();
+            nbIterations += elastique.getNbIterations();
+            unitesTravail += elastique.getUnitesTravail();
+            nbTests++;
+
+            if (infaisable()) {
+                retenue[k] = false;
+                aReprendre = -1;
+            } else {
+                aReprendre = k;
+            }
+        }
+
+        for (int k = 0; k < nbLignes; k++) {
+            if (retenue[k]) iis.push_back(lignes[k]);
+        }
+    }
+    return resultat;
+}
+
+void IisSimplexSolver::solve() {
+    iis.clear();
+    rayonFarkas.clear();
+    nbLignesSupport = 0;
+    nbTests = 0;
+    nbIterations = 0;
+    unitesTravail = 0;
+
+    const ProblemeLineaire& p = *probleme;
+    int m = p.matriceContraintes.size();
+
+    SimplexSolver complet(p);
+    complet.setModeSilencieux(true);
+    complet.solve();
+    nbIterations += complet.getNbIterations();
+    unitesTravail += complet.getUnitesTravail();
+    etatSolution = complet.getEtatSolution();
+
+    if (etatSolution != INFAISABLE) {
+        if (!modeSilencieux) afficherSolution();
+        return;
+    }
+
+    journal() << "\n=== RECHERCHE D'UN IIS ===" << endl;
+
+    // Ligne RANGE vide (l > u): infaisable à elle seule
+    for (int i = 0; i < m; i++) {
+        if (p.typesContraintes[i] == RANGE &&
+            p.bornesInferieures[i] - p.Bi[i] > TraitsScalaire<double>::epsilon()) {
+            journal() << "Contrainte " << (i + 1) << ": intervalle vide" << endl;
+            iis.push_back(i);
+            nbLignesSupport = 1;
+            if (!modeSilencieux) afficherSolution();
+            return;
+        }
+    }
+
+    // Support du rayon de Farkas, sinon toutes les lignes
+    rayonFarkas = complet.getRayonFarkas();
+    vector<int> lignes;
+    for (int i = 0; i < m; i++) {
+        if (rayonFarkas.empty() || rayonFarkas[i] != 0.0) lignes.push_back(i);
+    }
+    journal() << "Support du rayon de Farkas: " << lignes.size() << " contrainte(s) sur " << m << endl;
+
+    if (!filtrer(lignes) && static_cast<int>(lignes.size()) < m) {
+        // Support numériquement réalisable: filtre sur le modèle entier
+        journal() << "Support realisable a la tolerance pres: filtre sur toutes les contraintes" << endl;
+        lignes.resize(m);
+        for (int i = 0; i < m; i++) {
+            lignes[i] = i;
+        }
+        filtrer(lignes);
+    }
+
+    if (!modeSilencieux) afficherSolution();
+}
+
+void IisSimplexSolver::afficherSolution() const {
+    cout << "\n" << string(80, '=') << endl;
+    cout << "SOUS-SYSTEME INFAISABLE IRREDUCTIBLE (IIS)" << endl;
+    cout << string(80, '=') << "\n\n";
+
+    if (etatSolution != INFAISABLE) {
+        cout << "Le modele n'est pas infaisable: pas d'IIS.\n";
+    } else if (iis.empty()) {
+        cout << "*** IIS NON ETABLI (infaisabilite sous la tolerance) ***\n";
+    } else {
+        cout << "*** " << iis.size() << " contrainte(s) incompatible(s) ***\n";
+        cout << "Filtre: " << nbLignesSupport << " contrainte(s) testee(s), " << nbTests
+             << " resolution(s) a chaud, " << nbIterations << " iterations\n\n";
+
+        const ProblemeLineaire& p = *probleme;
+        for (int i : iis) {
+            cout << "  C" << (i + 1) << ": ";
+            bool premier = true;
+            for (size_t j = 0; j < p.fonctionObjectif.size(); j++) {
+                double a = p.matriceContraintes[i][j];
+                if (a == 0.0) continue;
+                cout << (premier ? "" : (a < 0.0 ? " - " : " + ")) << (premier ? a : fabs(a)) << "*x" << (j + 1);
+                premier = false;
+            }
+            if (premier) cout << "0";
+            switch (p.typesContraintes[i]) {
+            case LEQ:   cout << " <= " << p.Bi[i]; break;
+            case GEQ:   cout << " >= " << p.Bi[i]; break;
+            case EQ:    cout << " = " << p.Bi[i]; break;
+            case RANGE: cout << " dans [" << p.bornesInferieures[i] << ", " << p.Bi[i] << "]"; break;
+            }
+            cout << endl;
+        }
+    }
+
+    cout << "\n" << string(80, '=') << endl;
+}
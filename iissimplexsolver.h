@@ -0,0 +1,72 @@
+#ifndef IISSIMPLEXSOLVER_H
+#define IISSIMPLEXSOLVER_H
+
+#include "simplexsolver.h"
+#include <vector>
+#include <ostream>
+
+//
+// Sous-système infaisable irréductible (IIS) d'un modèle INFAISABLE: un
+// ensemble de contraintes incompatibles dont chaque sous-ensemble strict
+// est réalisable. Les signes des variables sont toujours conservés.
+//
+// 1. Le rayon de Farkas du modèle complet (SimplexSolverT::getRayonFarkas)
+//    désigne déjà un sous-système infaisable: son support.
+// 2. Sur ce support, modèle élastique: chaque ligne reçoit une variable
+//    de violation e >= 0 par sens (une pour LEQ/GEQ, deux pour EQ/RANGE)
+//    et l'on minimise sum w_i e_i. Le sous-système des lignes de poids 1
+//    est infaisable si et seulement si l'optimum est > 0; un poids nul
+//    retire la ligne.
+// 3. Filtre par suppression: chaque ligne est retirée à son tour, et
+//    reprise si le reste devient réalisable. Seuls les coûts changent
+//    d'un test à l'autre: la base optimale précédente reste réalisable
+//    et le même solveur repart de là (SimplexSolverT::reoptimiser), en
+//    quelques pivots, sans reconstruire de tableau.
+//
+class IisSimplexSolver {
+private:
+    ProblemePartage probleme;
+
+    // Résultats
+    TypeSolution etatSolution;        // état du modèle complet
+    std::vector<int> iis;             // indices des contraintes, croissants
+    std::vector<double> rayonFarkas;  // du modèle complet, vide s'il manque
+    int nbLignesSupport;              // lignes soumises au filtre
+    int nbTests;                      // réoptimisations du filtre
+    int nbIterations;
+    long long unitesTravail;
+
+    // Optimum élastique en deçà duquel le sous-système est réalisable,
+    // relatif à l'échelle des seconds membres
+    static constexpr double SEUIL_VIOLATION = 1e-9;
+
+    bool modeSilencieux;
+
+    std::ostream& journal() const { return fluxJournal(modeSilencieux); }
+
+    // Modèle élastique sur les lignes données; premiereViolation[k]: indice
+    // de la variable e de la ligne lignes[k] (la suivante aussi pour EQ/RANGE)
+    ProblemePartage construireModeleElastique(const std::vector<int>& lignes,
+                                              std::vector<int>& premiereViolation) const;
+    bool filtrer(const std::vector<int>& lignes);
+
+public:
+    explicit IisSimplexSolver(ProblemePartage problemePartage);
+
+    void setModeSilencieux(bool silencieux) { modeSilencieux = silencieux; }
+
+    void solve();
+    void afficherSolution() const;
+
+    // Getters pour l'interface
+    TypeSolution getEtatSolution() const { return etatSolution; }
+    // Vide si le modèle n'est pas INFAISABLE
+    std::vector<int> getIIS() const { return iis; }
+    std::vector<double> getRayonFarkas() const { return rayonFarkas; }
+    int getNbLignesSupport() const { return nbLignesSupport; }
+    int getNbTests() const { return nbTests; }
+    int getNbIterations() const { return nbIterations; }
+    long long getUnitesTravail() const { return unitesTravail; }
+};
+
+#endif // IISSIMPLEXSOLVER_H
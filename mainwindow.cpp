@@ -833,7 +833,8 @@ void MainWindow::onSolveDualClicked() {
         std::streambuf *old = std::cout.rdbuf(buffer.rdbuf());
 
         // Utiliser DualSimplexSolver au lieu de SimplexSolver
-        DualSimplexSolver solver(fobj, contraintes, Bi, types, typeObj, typesVar);
+        DualSimplexSolver solver(ProblemeLineaire::creer(std::move(fobj), std::move(contraintes), std::move(Bi),
+                                                         std::move(types), typeObj, std::move(typesVar)));
         solver.solve();
 
         std::cout.rdbuf(old);
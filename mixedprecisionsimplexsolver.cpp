@@ -0,0 +1,223 @@
+#include "mixedprecisionsimplexsolver.h"
+#include "factorisationlu.h"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+
+MixedPrecisionSimplexSolver::MixedPrecisionSimplexSolver(ProblemePartage problemePartage)
+    : probleme(std::move(problemePartage)), problemeDeveloppe(ProblemeLineaire::sansIntervalles(probleme)) {
+
+    etatSolution = EN_COURS;
+    valeurObjectif = 0.0;
+    solutionRaffinee = false;
+    dualementRealisable = false;
+
+    nbIterationsFloat = 0;
+    nbIterationsDouble = 0;
+    nbRaffinements = 0;
+    residuPrimal = 0.0;
+    residuDual = 0.0;
+
+    modeSilencieux = false;
+}
+
+void MixedPrecisionSimplexSolver::solve() {
+    // 1. Itérations en float
+    SimplexSolverT<float> solverFloat(*problemeDeveloppe);
+    solverFloat.setModeSilencieux(true);
+    solverFloat.solve();
+    nbIterationsFloat = solverFloat.getNbIterations();
+
+    // 2. Refactorisation en double depuis la base float (ou résolution
+    //    complète si le float n'a pas conclu à l'optimalité)
+    SimplexSolver solverDouble(*problemeDeveloppe);
+    solverDouble.setModeSilencieux(modeSilencieux);
+
+    if (solverFloat.getEtatSolution() == OPTIMALE) {
+        solverDouble.solveDepuisBase(solverFloat.getBase());
+    } else {
+        solverDouble.solve();
+    }
+    nbIterationsDouble = solverDouble.getNbIterations();
+
+    etatSolution = solverDouble.getEtatSolution();
+    solutionRaffinee = false;
+    valeursDuales.clear();
+
+    if (etatSolution == OPTIMALE) {
+        // 3. Raffinement itératif de x_B et y
+        raffinerSolution(solverDouble);
+    }
+
+    valeurObjectif = solverDouble.getValeurObjectif();
+    solutionOptimale = solverDouble.getSolutionOptimale();
+
+    if (!modeSilencieux) afficherSolution();
+}
+
+void MixedPrecisionSimplexSolver::raffinerSolution(SimplexSolver& solverDouble) {
+    int m = solverDouble.getNbContraintes();
+    int n = solverDouble.getNbColonnesFormeStandard();
+    vector<int> base = solverDouble.getBase();
+
+    // Une variable artificielle restée en base (niveau 0) n'a pas de
+    // colonne dans la forme standard: pas de raffinement possible
+    vector<bool> dejaVue(n, false);
+    for (int j : base) {
+        if (j < 0 || j >= n || dejaVue[j]) return;
+        dejaVue[j] = true;
+    }
+
+    vector<vector<double>> colonnes(n);
+    for (int j = 0; j < n; j++) {
+        colonnes[j] = solverDouble.getColonneFormeStandard(j);
+    }
+
+    vector<vector<double>> B(m, vector<double>(m));
+    for (int i = 0; i < m; i++) {
+        for (int k = 0; k < m; k++) {
+            B[i][k] = colonnes[base[k]][i];
+        }
+    }
+
+    FactorisationLU<double> lu;
+    if (!lu.factoriser(B)) return;
+
+    vector<double> b = solverDouble.getSecondMembre();
+
+    // Primal: B x_B = b
+    vector<double> xB = lu.resoudre(b);
+    nbRaffinements = 0;
+    double normeDPrecedente = HUGE_VAL;
+    for (int iter = 0; ; iter++) {
+        vector<double> r(m);
+        double normeR = 0.0, normeX = 0.0;
+        for (int i = 0; i < m; i++) {
+            long double somme = b[i];
+            for (int k = 0; k < m; k++) {
+                somme -= static_cast<long double>(B[i][k]) * xB[k];
+            }
+            r[i] = static_cast<double>(somme);
+            normeR = max(normeR, fabs(r[i]));
+            normeX = max(normeX, fabs(xB[i]));
+        }
+        residuPrimal = normeR;
+        if (normeR == 0.0 || iter >= MAX_RAFFINEMENTS) break;
+
+        // Arrêt quand la correction devient négligeable ou stagne
+        vector<double> d = lu.resoudre(r);
+        double normeD = 0.0;
+        for (int i = 0; i < m; i++) {
+            xB[i] += d[i];
+            normeD = max(normeD, fabs(d[i]));
+        }
+        nbRaffinements++;
+        if (normeD <= TOLERANCE_CORRECTION * normeX || normeD > 0.5 * normeDPrecedente) break;
+        normeDPrecedente = normeD;
+    }
+
+    // Dual: B^T y = c_B
+    vector<double> cB(m);
+    for (int k = 0; k < m; k++) {
+        cB[k] = solverDouble.getCoutFormeStandard(base[k]);
+    }
+    vector<double> y = lu.resoudreTransposee(cB);
+    normeDPrecedente = HUGE_VAL;
+    for (int iter = 0; ; iter++) {
+        vector<double> r(m);
+        double normeR = 0.0, normeY = 0.0;
+        for (int k = 0; k < m; k++) {
+            long double somme = cB[k];
+            for (int i = 0; i < m; i++) {
+                somme -= static_cast<long double>(B[i][k]) * y[i];
+            }
+            r[k] = static_cast<double>(somme);
+            normeR = max(normeR, fabs(r[k]));
+            normeY = max(normeY, fabs(y[k]));
+        }
+        residuDual = normeR;
+        if (normeR == 0.0 || iter >= MAX_RAFFINEMENTS) break;
+
+        vector<double> d = lu.resoudreTransposee(r);
+        double normeD = 0.0;
+        for (int i = 0; i < m; i++) {
+            y[i] += d[i];
+            normeD = max(normeD, fabs(d[i]));
+        }
+        nbRaffinements++;
+        if (normeD <= TOLERANCE_CORRECTION * normeY || normeD > 0.5 * normeDPrecedente) break;
+        normeDPrecedente = normeD;
+    }
+
+    // Coûts réduits d_j = c_j - y.a_j (signe attendu selon MAX/MIN)
+    dualementRealisable = true;
+    for (int j = 0; j < n && dualementRealisable; j++) {
+        if (dejaVue[j]) continue;
+        long double d = solverDouble.getCoutFormeStandard(j);
+        for (int i = 0; i < m; i++) {
+            d -= static_cast<long double>(y[i]) * colonnes[j][i];
+        }
+        if (solverDouble.estVariableLibre(j) ? fabs(d) > EPSILON
+                : (probleme->typeObj == MAX && d > EPSILON) || (probleme->typeObj == MIN && d < -EPSILON)) {
+            dualementRealisable = false;
+        }
+    }
+
+    vector<double> xStandard(n, 0.0);
+    for (int k = 0; k < m; k++) {
+        // Les valeurs de base négatives au bruit près sont ramenées à 0
+        // (sauf pour une variable libre, sans borne)
+        bool bruit = xB[k] < 0.0 && xB[k] > -EPSILON && !solverDouble.estVariableLibre(base[k]);
+        xStandard[base[k]] = bruit ? 0.0 : xB[k];
+    }
+    solverDouble.appliquerSolutionFormeStandard(xStandard);
+
+    // Valeurs duales exprimées sur les lignes du modèle d'origine
+    valeursDuales.resize(m);
+    for (int i = 0; i < m; i++) {
+        valeursDuales[i] = solverDouble.estLigneInversee(i) ? -y[i] : y[i];
+    }
+    probleme->replierValeursDuales(valeursDuales);
+    solutionRaffinee = true;
+}
+
+void MixedPrecisionSimplexSolver::afficherSolution() const {
+    cout << "\n" << string(80, '=') << endl;
+    cout << "PRECISION MIXTE (float + raffinement double)" << endl;
+    cout << string(80, '=') << "\n\n";
+
+    cout << "Iterations en float  : " << nbIterationsFloat << "\n";
+    cout << "Iterations en double : " << nbIterationsDouble << "\n";
+
+    if (etatSolution == OPTIMALE) {
+        cout << "*** SOLUTION OPTIMALE ATTEINTE ***\n\n";
+        cout << "Valeur optimale de Z = " << fixed << setprecision(4) << valeurObjectif << "\n\n";
+        for (size_t i = 0; i < solutionOptimale.size(); i++) {
+            cout << "  x" << (i + 1) << " = " << fixed << setprecision(4)
+                 << solutionOptimale[i] << endl;
+        }
+
+        if (solutionRaffinee) {
+            cout << "\nRaffinement iteratif: " << nbRaffinements << " correction(s)\n";
+            cout << "  ||B x_B - b||     = " << scientific << setprecision(3) << residuPrimal << "\n";
+            cout << "  ||B^T y - c_B||   = " << scientific << setprecision(3) << residuDual << "\n";
+            cout << "  Couts reduits     : "
+                 << (dualementRealisable ? "base optimale en double" : "ATTENTION: base non optimale") << "\n";
+            cout << defaultfloat;
+
+            cout << "\nValeurs duales (prix ombres):\n";
+            for (size_t i = 0; i < valeursDuales.size(); i++) {
+                cout << "  y" << (i + 1) << " = " << fixed << setprecision(4) << valeursDuales[i] << endl;
+            }
+        }
+    } else if (etatSolution == NON_BORNE) {
+        cout << "*** PROBLEME NON BORNE ***\n";
+    } else if (etatSolution == INFAISABLE) {
+        cout << "*** AUCUNE SOLUTION REALISABLE ***\n";
+    }
+
+    cout << "\n" << string(80, '=') << endl;
+}
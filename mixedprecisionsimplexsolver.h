@@ -0,0 +1,67 @@
+#ifndef MIXEDPRECISIONSIMPLEXSOLVER_H
+#define MIXEDPRECISIONSIMPLEXSOLVER_H
+
+#include "simplexsolver.h"
+#include <vector>
+
+//
+// Résolution en précision mixte:
+//  1. les itérations du simplexe tournent sur un tableau en float
+//     (deux fois moins de trafic mémoire dans pivoter());
+//  2. la base finale est refactorisée en double et la phase 2 reprend
+//     depuis cette base si elle n'est pas optimale en double;
+//  3. x_B et les valeurs duales sont corrigés par raffinement itératif
+//     (résidus calculés en long double) jusqu'à ce que la correction
+//     devienne négligeable à l'epsilon machine du double près.
+//
+class MixedPrecisionSimplexSolver {
+private:
+    ProblemePartage probleme;
+    ProblemePartage problemeDeveloppe;   // lignes RANGE en deux lignes: bases sans bornes
+
+    // Résultats
+    TypeSolution etatSolution;
+    double valeurObjectif;
+    std::vector<double> solutionOptimale;
+    std::vector<double> valeursDuales;
+    bool solutionRaffinee;
+    bool dualementRealisable;
+
+    // Statistiques
+    int nbIterationsFloat;
+    int nbIterationsDouble;
+    int nbRaffinements;
+    double residuPrimal;   // ||B x_B - b||inf
+    double residuDual;     // ||B^T y - c_B||inf
+
+    const int MAX_RAFFINEMENTS = 10;
+    const double TOLERANCE_CORRECTION = 2.2e-16;  // ||d|| <= eps.||x||
+    const double EPSILON = 1e-9;
+
+    bool modeSilencieux;
+
+    void raffinerSolution(SimplexSolver& solverDouble);
+
+public:
+    explicit MixedPrecisionSimplexSolver(ProblemePartage problemePartage);
+
+    void setModeSilencieux(bool silencieux) { modeSilencieux = silencieux; }
+
+    void solve();
+    void afficherSolution() const;
+
+    // Getters pour l'interface
+    TypeSolution getEtatSolution() const { return etatSolution; }
+    double getValeurObjectif() const { return valeurObjectif; }
+    std::vector<double> getSolutionOptimale() const { return solutionOptimale; }
+    std::vector<double> getValeursDuales() const { return valeursDuales; }
+    bool estSolutionRaffinee() const { return solutionRaffinee; }
+    bool estDualementRealisable() const { return dualementRealisable; }
+    int getNbIterationsFloat() const { return nbIterationsFloat; }
+    int getNbIterationsDouble() const { return nbIterationsDouble; }
+    int getNbRaffinements() const { return nbRaffinements; }
+    double getResiduPrimal() const { return residuPrimal; }
+    double getResiduDual() const { return residuDual; }
+};
+
+#endif // MIXEDPRECISIONSIMPLEXSOLVER_H
@@ -0,0 +1,256 @@
+#include "rationnel.h"
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+
+using namespace std;
+
+namespace {
+
+const int64_t MAX_INT64 = INT64_MAX;
+const int64_t MIN_INT64 = INT64_MIN;
+
+bool tientSur64Bits(__int128 v) {
+    return v >= MIN_INT64 && v <= MAX_INT64;
+}
+
+unsigned __int128 pgcd128(unsigned __int128 a, unsigned __int128 b) {
+    while (b != 0) {
+        unsigned __int128 r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+}
+
+Rationnel::Rationnel(int64_t numerateur, int64_t denominateur) {
+    if (denominateur == 0) throw domain_error("Rationnel: denominateur nul");
+    *this = depuis128(numerateur, denominateur);
+}
+
+Rationnel Rationnel::depuis128(__int128 n, __int128 d) {
+    if (d < 0) {
+        n = -n;
+        d = -d;
+    }
+
+    Rationnel resultat;
+    // Chemin rapide: pas de réduction tant que la fraction tient sur 64 bits
+    if (tientSur64Bits(n) && tientSur64Bits(d)) {
+        resultat.num = static_cast<int64_t>(n);
+        resultat.den = static_cast<int64_t>(d);
+        return resultat;
+    }
+
+    unsigned __int128 magnitude = n < 0 ? static_cast<unsigned __int128>(-n) : static_cast<unsigned __int128>(n);
+    unsigned __int128 g = pgcd128(magnitude, static_cast<unsigned __int128>(d));
+    if (g > 1) {
+        n /= static_cast<__int128>(g);
+        d /= static_cast<__int128>(g);
+    }
+    if (tientSur64Bits(n) && tientSur64Bits(d)) {
+        resultat.num = static_cast<int64_t>(n);
+        resultat.den = static_cast<int64_t>(d);
+        return resultat;
+    }
+
+    return depuisGrand(GrandEntier(n), GrandEntier(d));
+}
+
+Rationnel Rationnel::depuisGrand(GrandEntier n, GrandEntier d) {
+    if (d.estZero()) throw domain_error("Rationnel: division par zero");
+    if (d.estNegatif()) {
+        n = -n;
+        d = -d;
+    }
+
+    GrandEntier g = GrandEntier::pgcd(n, d);
+    if (!(g == GrandEntier(static_cast<int64_t>(1))) && !g.estZero()) {
+        n = n / g;
+        d = d / g;
+    }
+
+    Rationnel resultat;
+    if (n.tientSur64Bits() && d.tientSur64Bits()) {
+        resultat.num = n.versInt64();
+        resultat.den = d.versInt64();
+        return resultat;
+    }
+
+    auto valeur = make_shared<Grand>();
+    valeur->num = n;
+    valeur->den = d;
+    resultat.grand = valeur;
+    return resultat;
+}
+
+void Rationnel::versGrand(GrandEntier& n, GrandEntier& d) const {
+    if (grand) {
+        n = grand->num;
+        d = grand->den;
+    } else {
+        n = GrandEntier(num);
+        d = GrandEntier(den);
+    }
+}
+
+Rationnel Rationnel::depuisDouble(double valeur) {
+    if (!std::isfinite(valeur)) throw domain_error("Rationnel: valeur non finie");
+
+    // Entier exact
+    if (valeur == std::floor(valeur) && std::fabs(valeur) < 9.0e18) {
+        return Rationnel(static_cast<int64_t>(valeur));
+    }
+
+    // Fractions continues: 0.1 -> 1/10, 0.333333333333 -> 1/3
+    const long double TOLERANCE = 1e-12L;
+    const long double MAX_DENOMINATEUR = 1e12L;
+    long double cible = std::fabs(static_cast<long double>(valeur));
+    long double x = cible;
+    long double h1 = 1, h2 = 0, k1 = 0, k2 = 1;
+    for (int terme = 0; terme < 64; terme++) {
+        long double a = std::floor(x);
+        long double h = a * h1 + h2;
+        long double k = a * k1 + k2;
+        if (k > MAX_DENOMINATEUR || h > 9.0e18L) break;
+
+        if (std::fabs(h / k - cible) <= TOLERANCE * cible) {
+            int64_t n = static_cast<int64_t>(h);
+            return Rationnel(valeur < 0 ? -n : n, static_cast<int64_t>(k));
+        }
+        h2 = h1; h1 = h;
+        k2 = k1; k1 = k;
+        if (x - a == 0) break;
+        x = 1 / (x - a);
+    }
+
+    // Sinon: valeur binaire exacte mantisse * 2^exposant
+    int exposant;
+    double mantisse = std::frexp(valeur, &exposant);
+    int64_t entier = static_cast<int64_t>(std::ldexp(mantisse, 53));
+    exposant -= 53;
+    if (exposant >= 0) {
+        return depuisGrand(GrandEntier(entier).decalerGauche(exposant), GrandEntier(static_cast<int64_t>(1)));
+    }
+    return depuisGrand(GrandEntier(entier), GrandEntier(static_cast<int64_t>(1)).decalerGauche(-exposant));
+}
+
+double Rationnel::versDouble() const {
+    if (!grand) {
+        return static_cast<double>(static_cast<long double>(num) / den);
+    }
+    int exposantNum, exposantDen;
+    double n = grand->num.versDouble(exposantNum);
+    double d = grand->den.versDouble(exposantDen);
+    return std::ldexp(n / d, exposantNum - exposantDen);
+}
+
+int Rationnel::signe() const {
+    if (grand) return grand->num.signe();
+    return (num > 0) - (num < 0);
+}
+
+Rationnel Rationnel::reduit() const {
+    if (grand) return *this;
+    unsigned __int128 magnitude = num < 0 ? -static_cast<__int128>(num) : num;
+    unsigned __int128 g = pgcd128(magnitude, static_cast<unsigned __int128>(den));
+    Rationnel resultat;
+    if (g > 1) {
+        resultat.num = static_cast<int64_t>(num / static_cast<__int128>(g));
+        resultat.den = static_cast<int64_t>(den / static_cast<__int128>(g));
+    } else {
+        resultat.num = num;
+        resultat.den = den;
+    }
+    return resultat;
+}
+
+string Rationnel::versChaine() const {
+    if (grand) {
+        return grand->num.versChaine() + "/" + grand->den.versChaine();
+    }
+    Rationnel r = reduit();
+    if (r.den == 1) return to_string(r.num);
+    return to_string(r.num) + "/" + to_string(r.den);
+}
+
+Rationnel Rationnel::operator-() const {
+    if (grand) return depuisGrand(-grand->num, grand->den);
+    if (num == MIN_INT64) return depuis128(-static_cast<__int128>(num), den);
+    Rationnel resultat;
+    resultat.num = -num;
+    resultat.den = den;
+    return resultat;
+}
+
+Rationnel operator+(const Rationnel& a, const Rationnel& b) {
+    if (!a.grand && !b.grand) {
+        if (a.den == b.den) {
+            return Rationnel::depuis128(static_cast<__int128>(a.num) + b.num, a.den);
+        }
+        __int128 n;
+        if (!__builtin_add_overflow(static_cast<__int128>(a.num) * b.den,
+                                    static_cast<__int128>(b.num) * a.den, &n)) {
+            return Rationnel::depuis128(n, static_cast<__int128>(a.den) * b.den);
+        }
+    }
+    GrandEntier an, ad, bn, bd;
+    a.versGrand(an, ad);
+    b.versGrand(bn, bd);
+    return Rationnel::depuisGrand(an * bd + bn * ad, ad * bd);
+}
+
+Rationnel operator-(const Rationnel& a, const Rationnel& b) {
+    if (!a.grand && !b.grand) {
+        if (a.den == b.den) {
+            return Rationnel::depuis128(static_cast<__int128>(a.num) - b.num, a.den);
+        }
+        __int128 n;
+        if (!__builtin_sub_overflow(static_cast<__int128>(a.num) * b.den,
+                                    static_cast<__int128>(b.num) * a.den, &n)) {
+            return Rationnel::depuis128(n, static_cast<__int128>(a.den) * b.den);
+        }
+    }
+    GrandEntier an, ad, bn, bd;
+    a.versGrand(an, ad);
+    b.versGrand(bn, bd);
+    return Rationnel::depuisGrand(an * bd - bn * ad, ad * bd);
+}
+
+Rationnel operator*(const Rationnel& a, const Rationnel& b) {
+    if (!a.grand && !b.grand) {
+        return Rationnel::depuis128(static_cast<__int128>(a.num) * b.num,
+                                    static_cast<__int128>(a.den) * b.den);
+    }
+    GrandEntier an, ad, bn, bd;
+    a.versGrand(an, ad);
+    b.versGrand(bn, bd);
+    return Rationnel::depuisGrand(an * bn, ad * bd);
+}
+
+Rationnel operator/(const Rationnel& a, const Rationnel& b) {
+    if (b.signe() == 0) throw domain_error("Rationnel: division par zero");
+    if (!a.grand && !b.grand) {
+        return Rationnel::depuis128(static_cast<__int128>(a.num) * b.den,
+                                    static_cast<__int128>(a.den) * b.num);
+    }
+    GrandEntier an, ad, bn, bd;
+    a.versGrand(an, ad);
+    b.versGrand(bn, bd);
+    return Rationnel::depuisGrand(an * bd, ad * bn);
+}
+
+int comparer(const Rationnel& a, const Rationnel& b) {
+    if (!a.grand && !b.grand) {
+        // Dénominateurs positifs: comparer a.num*b.den et b.num*a.den
+        __int128 gauche = static_cast<__int128>(a.num) * b.den;
+        __int128 droite = static_cast<__int128>(b.num) * a.den;
+        return (gauche > droite) - (gauche < droite);
+    }
+    GrandEntier an, ad, bn, bd;
+    a.versGrand(an, ad);
+    b.versGrand(bn, bd);
+    return comparer(an * bd, bn * ad);
+}
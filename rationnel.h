@@ -0,0 +1,85 @@
+#ifndef RATIONNEL_H
+#define RATIONNEL_H
+
+#include "simplexsolver.h"
+#include "grandentier.h"
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+
+//
+// Nombre rationnel exact.
+// Chemin rapide: numérateur/dénominateur en int64, calculs intermédiaires
+// en __int128. La réduction par le PGCD est différée: elle n'a lieu que
+// lorsqu'un résultat ne tient plus sur 64 bits. Si même la forme réduite
+// déborde, la valeur passe en GrandEntier (et redescend dès qu'elle tient).
+//
+class Rationnel {
+private:
+    struct Grand {
+        GrandEntier num;
+        GrandEntier den;   // > 0, fraction réduite
+    };
+
+    int64_t num;
+    int64_t den;                        // > 0, pas forcément réduite
+    std::shared_ptr<const Grand> grand; // non nul => représentation étendue
+
+    static Rationnel depuis128(__int128 n, __int128 d);
+    static Rationnel depuisGrand(GrandEntier n, GrandEntier d);
+    void versGrand(GrandEntier& n, GrandEntier& d) const;
+
+    friend int comparer(const Rationnel& a, const Rationnel& b);
+
+public:
+    Rationnel() : num(0), den(1) {}
+    Rationnel(int64_t valeur) : num(valeur), den(1) {}
+    Rationnel(int64_t numerateur, int64_t denominateur);
+
+    static Rationnel depuisDouble(double valeur);
+    double versDouble() const;
+
+    bool estGrand() const { return grand != nullptr; }
+    int signe() const;
+    Rationnel abs() const { return signe() < 0 ? -*this : *this; }
+    Rationnel reduit() const;
+    std::string versChaine() const;
+
+    Rationnel operator-() const;
+    Rationnel& operator+=(const Rationnel& b) { return *this = *this + b; }
+    Rationnel& operator-=(const Rationnel& b) { return *this = *this - b; }
+    Rationnel& operator*=(const Rationnel& b) { return *this = *this * b; }
+    Rationnel& operator/=(const Rationnel& b) { return *this = *this / b; }
+
+    friend Rationnel operator+(const Rationnel& a, const Rationnel& b);
+    friend Rationnel operator-(const Rationnel& a, const Rationnel& b);
+    friend Rationnel operator*(const Rationnel& a, const Rationnel& b);
+    friend Rationnel operator/(const Rationnel& a, const Rationnel& b);
+
+    friend bool operator==(const Rationnel& a, const Rationnel& b) { return comparer(a, b) == 0; }
+    friend bool operator!=(const Rationnel& a, const Rationnel& b) { return comparer(a, b) != 0; }
+    friend bool operator<(const Rationnel& a, const Rationnel& b) { return comparer(a, b) < 0; }
+    friend bool operator>(const Rationnel& a, const Rationnel& b) { return comparer(a, b) > 0; }
+    friend bool operator<=(const Rationnel& a, const Rationnel& b) { return comparer(a, b) <= 0; }
+    friend bool operator>=(const Rationnel& a, const Rationnel& b) { return comparer(a, b) >= 0; }
+
+    friend std::ostream& operator<<(std::ostream& os, const Rationnel& r) { return os << r.versChaine(); }
+};
+
+// Arithmétique exacte: tolérance nulle
+template<>
+struct TraitsScalaire<Rationnel> {
+    static Rationnel epsilon() { return Rationnel(0); }
+    static Rationnel abs(const Rationnel& v) { return v.abs(); }
+    static Rationnel depuisDouble(double v) { return Rationnel::depuisDouble(v); }
+    static double versDouble(const Rationnel& v) { return v.versDouble(); }
+    static double seuilDerive() { return 0.0; }   // rien ne dérive
+};
+
+extern template class SimplexSolverT<Rationnel>;
+
+// Moteur en arithmétique rationnelle exacte
+using SimplexSolverExact = SimplexSolverT<Rationnel>;
+
+#endif // RATIONNEL_H
@@ -0,0 +1,81 @@
+#ifndef RESSOURCEMEMOIRE_H
+#define RESSOURCEMEMOIRE_H
+
+#include <cstddef>
+#include <memory_resource>
+
+//
+// Ressources mémoire pour les solveurs (std::pmr).
+//
+// Usage typique d'un worker de calcul par lots:
+//
+//   PoolSolveur pool;                       // un par thread
+//   for (...) {
+//       SimplexSolver solver(c, A, b, types, MAX, typesVar, &pool);
+//       solver.setModeSilencieux(true);
+//       solver.solve();
+//   }
+//
+// Chaque solveur prend son arène dans le pool et la lui rend à sa
+// destruction: après la première résolution, plus aucun appel à malloc.
+//
+
+// Pool non synchronisé (un par thread) dont les blocs sont assez grands
+// pour les arènes des solveurs: au-delà de largest_required_pool_block,
+// les demandes repartiraient directement vers malloc.
+class PoolSolveur : public std::pmr::unsynchronized_pool_resource {
+public:
+    explicit PoolSolveur(std::pmr::memory_resource* amont = std::pmr::get_default_resource())
+        : std::pmr::unsynchronized_pool_resource(optionsPool(), amont) {}
+
+private:
+    static std::pmr::pool_options optionsPool() {
+        std::pmr::pool_options options;
+        options.max_blocks_per_chunk = 0;                   // défaut de l'implémentation
+        options.largest_required_pool_block = 1 << 24;      // 16 Mo
+        return options;
+    }
+};
+
+// Ressource transparente qui compte les allocations transmises à sa
+// ressource amont. Placée sous un pool, elle mesure le nombre d'appels
+// réels au système: 0 en régime établi. Non synchronisée.
+class CompteurAllocations : public std::pmr::memory_resource {
+private:
+    std::pmr::memory_resource* amont;
+    std::size_t nbAllocations;
+    std::size_t nbLiberations;
+    std::size_t octetsAlloues;
+
+protected:
+    void* do_allocate(std::size_t octets, std::size_t alignement) override {
+        nbAllocations++;
+        octetsAlloues += octets;
+        return amont->allocate(octets, alignement);
+    }
+
+    void do_deallocate(void* p, std::size_t octets, std::size_t alignement) override {
+        nbLiberations++;
+        amont->deallocate(p, octets, alignement);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& autre) const noexcept override {
+        return this == &autre;
+    }
+
+public:
+    explicit CompteurAllocations(std::pmr::memory_resource* ressourceAmont = std::pmr::get_default_resource())
+        : amont(ressourceAmont), nbAllocations(0), nbLiberations(0), octetsAlloues(0) {}
+
+    void reinitialiser() {
+        nbAllocations = 0;
+        nbLiberations = 0;
+        octetsAlloues = 0;
+    }
+
+    std::size_t getNbAllocations() const { return nbAllocations; }
+    std::size_t getNbLiberations() const { return nbLiberations; }
+    std::size_t getOctetsAlloues() const { return octetsAlloues; }
+};
+
+#endif // RESSOURCEMEMOIRE_H
@@ -1,4 +1,6 @@
 #include "simplexsolver.h"
+#include "rationnel.h"
+#include "factorisationlu.h"
 
 //
 // SimplexSolver - Based on Algerian University Course
@@ -13,37 +15,201 @@
 #include <fstream>
 #include <string>
 #include <stdexcept>
+#include <algorithm>
 
 using namespace std;
 
+// Construite une seule fois: pas d'allocation par résolution, même en
+// mode silencieux où le texte est écrit dans un flux nul
+static const string LIGNE_SEPARATION(80, '=');
+
+bool VueProblemeLineaire::estRayonFarkas(const vector<double>& y, double tolerance) const {
+    int m = getNbContraintes();
+    int n = getNbVariables();
+    if (static_cast<int>(y.size()) != m) return false;
+
+    // y.A accumulé ligne par ligne sur le support de y
+    vector<double> produit(n, 0.0), echelle(n, 0.0);
+    double somme = 0.0, echelleSomme = 0.0;
+    for (int i = 0; i < m; i++) {
+        double v = y[i];
+        if (v == 0.0) continue;
+        TypeContrainte type = typeContrainte(i);
+        if ((type == LEQ && v < 0.0) || (type == GEQ && v > 0.0)) return false;
+        if (type == RANGE && !aBorneInferieure(i)) return false;
+        double b = (type == RANGE && v < 0.0) ? borneInferieure(i) : secondMembre(i);
+        somme += v * b;
+        echelleSomme += fabs(v * b);
+        for (int j = 0; j < n; j++) {
+            double a = coefficient(i, j);
+            if (a == 0.0) continue;
+            produit[j] += v * a;
+            echelle[j] += fabs(v * a);
+        }
+    }
+    if (!(somme < -tolerance * (1.0 + echelleSomme))) return false;
 
-SimplexSolver::SimplexSolver(const vector<double>& fobj,
-                             const vector<vector<double>>& contraintes,
-                             const vector<double>& b,
-                             const vector<TypeContrainte>& types,
-                             TypeObjectif type,
-                             const vector<TypeVariable>& typesVar)
-    : fonctionObjectif(fobj), matriceContraintes(contraintes),
-    Bi(b), typesContraintes(types), typeObj(type) {
+    for (int j = 0; j < n; j++) {
+        double t = tolerance * (1.0 + echelle[j]);
+        TypeVariable type = typeVariable(j);
+        if (type != NON_POSITIVE && produit[j] < -t) return false;
+        if (type != NON_NEGATIVE && produit[j] > t) return false;
+    }
+    return true;
+}
 
-    nbVariablesOriginales = fobj.size();
-    nbContraintes = contraintes.size();
-    etatSolution = EN_COURS;
-    valeurObjectif = 0.0;
+bool VueProblemeLineaire::estRayonNonBorne(const vector<double>& r, double tolerance) const {
+    int m = getNbContraintes();
+    int n = getNbVariables();
+    if (static_cast<int>(r.size()) != n) return false;
+
+    double coutRayon = 0.0, echelle = 0.0;
+    for (int j = 0; j < n; j++) {
+        if (r[j] == 0.0) continue;
+        TypeVariable type = typeVariable(j);
+        if ((type == NON_NEGATIVE && r[j] < 0.0) || (type == NON_POSITIVE && r[j] > 0.0)) return false;
+        coutRayon += coutVariable(j) * r[j];
+        echelle += fabs(coutVariable(j) * r[j]);
+    }
+    double t = tolerance * (1.0 + echelle);
+    if (getTypeObjectif() == MAX ? !(coutRayon > t) : !(coutRayon < -t)) return false;
+
+    for (int i = 0; i < m; i++) {
+        double produit = 0.0, echelleLigne = 0.0;
+        for (int j = 0; j < n; j++) {
+            if (r[j] == 0.0) continue;
+            double a = coefficient(i, j);
+            if (a == 0.0) continue;
+            produit += a * r[j];
+            echelleLigne += fabs(a * r[j]);
+        }
+        t = tolerance * (1.0 + echelleLigne);
+        TypeContrainte type = typeContrainte(i);
+        if (type != GEQ && produit > t) return false;
+        if (type != LEQ && produit < -t) return false;
+    }
+    return true;
+}
 
-    // If no variable types provided, assume all are NON_NEGATIVE
-    if (typesVar.empty()) {
-        typesVariables.resize(nbVariablesOriginales, NON_NEGATIVE);
+template<typename T>
+SimplexSolverT<T>::SimplexSolverT(const VueProblemeLineaire& vue, pmr::memory_resource* ressource)
+    : arene(tailleInitialeArene(vue.getNbVariables(), vue.getNbContraintes()), ressource),
+    areneResolution(tailleInitialeResolution(vue.getNbVariables(), vue.getNbContraintes()), ressource),
+    temporaires(pmr::pool_options{4, 0}, &areneResolution),
+    fonctionObjectif(&arene), matriceContraintes(vue.getNbContraintes(), &arene),
+    Bi(&arene), typesContraintes(&arene), typeObj(vue.getTypeObjectif()),
+    lignesInversees(&arene), ligneIntervalle(&arene), etendueLigne(&arene), intervalleVide(false),
+    colonneBornee(&areneResolution), borneColonne(&areneResolution), colonneAuMax(&areneResolution),
+    ensembleVariable(&arene), secondMembreGub(&arene), ensembleColonne(&areneResolution),
+    cleGub(&areneResolution), tauxCleGub(&areneResolution), valeurCleGub(&areneResolution),
+    pointsRupture(&arene), pentesMorceaux(&arene),
+    ancreMorceau(&areneResolution), morceauDecroissant(&areneResolution),
+    pointsFranchis(&areneResolution),
+    typesVariables(&arene), colonneInversee(&arene), variableLibre(&arene),
+    tableau(&areneResolution), base(&areneResolution), nomsVariables(&areneResolution),
+    lignesArtificiellesEnBase(&areneResolution),
+    solutionOptimale(&areneResolution),
+    ligneColonne(&areneResolution), colonneArtificielle(&areneResolution), normeColonne(&areneResolution),
+    valeursControle(&areneResolution), coutsControle(&areneResolution), residusControle(&areneResolution),
+    baseReinversion(&areneResolution), tableauReinversion(&areneResolution),
+    modeSilencieux(false), drapeauArret(nullptr), interrompu(false),
+    causeArret(ARRET_AUCUN), unitesTravail(0), solutionRealisable(false),
+    rayonFarkas(&areneResolution), rayonNonBorne(&areneResolution) {
+
+    // Conversion des données du modèle (double) vers le type scalaire du
+    // moteur, lues dans l'ordre de leur stockage: par colonnes pour une
+    // vue duale, dont les colonnes sont les lignes du primal
+    int m = vue.getNbContraintes();
+    int n = vue.getNbVariables();
+    fonctionObjectif.resize(n);
+    typesVariables.resize(n);
+    for (int j = 0; j < n; j++) {
+        fonctionObjectif[j] = TraitsScalaire<T>::depuisDouble(vue.coutVariable(j));
+        typesVariables[j] = vue.typeVariable(j);
+    }
+    Bi.resize(m);
+    typesContraintes.resize(m);
+    for (int i = 0; i < m; i++) {
+        Bi[i] = TraitsScalaire<T>::depuisDouble(vue.secondMembre(i));
+        typesContraintes[i] = vue.typeContrainte(i);
+        matriceContraintes[i].resize(n);
+    }
+    if (vue.estDuale()) {
+        for (int j = 0; j < n; j++) {
+            for (int i = 0; i < m; i++) {
+                matriceContraintes[i][j] = TraitsScalaire<T>::depuisDouble(vue.coefficient(i, j));
+            }
+        }
     } else {
-        typesVariables = typesVar;
+        for (int i = 0; i < m; i++) {
+            for (int j = 0; j < n; j++) {
+                matriceContraintes[i][j] = TraitsScalaire<T>::depuisDouble(vue.coefficient(i, j));
+            }
+        }
     }
 
+    nbVariablesOriginales = n;
+    nbContraintes = m;
+    etatSolution = EN_COURS;
+    valeurObjectif = T(0);
+    nbIterations = 0;
+    nbPivotsDegeneres = 0;
+    nbPivotsDegeneresConsecutifs = 0;
+    regleBland = false;
+    crashActif = true;
+    nbPivotsCrash = 0;
+    modeComposite = false;
+    modeGub = false;
+    nbVariablesMorcelees = 0;
+    coutsParMorceauxActifs = false;
+    periodeControle = PERIODE_CONTROLE;
+    iterationsDepuisControle = 0;
+    controleAnticipe = false;
+    phaseRealisabilite = false;
+    reinversionEnCours = false;
+
     // Initialize solution vector (will be resized after preprocessing)
-    solutionOptimale.resize(nbVariablesOriginales, 0.0);
+    solutionOptimale.resize(nbVariablesOriginales, T(0));
 
     // NORMALISATION: S'assurer que tous les Bi >= 0
+    lignesInversees.assign(nbContraintes, false);
+    ligneIntervalle.assign(nbContraintes, false);
+    etendueLigne.assign(nbContraintes, T(0));
     for (int i = 0; i < nbContraintes; i++) {
+        if (typesContraintes[i] == RANGE) {
+            if (!vue.aBorneInferieure(i)) {
+                throw invalid_argument("Contrainte RANGE sans borne inferieure");
+            }
+            // l <= a.x <= u, ramenée à u >= 0, devient une seule ligne:
+            // LEQ si l <= 0 (écart de départ u, dans [0, u - l]), sinon
+            // GEQ de second membre l (excédent a.x - l, dans [0, u - l])
+            T l = TraitsScalaire<T>::depuisDouble(vue.borneInferieure(i));
+            T u = Bi[i];
+            if (EPSILON < l - u) intervalleVide = true;
+            if (u < -EPSILON) {
+                lignesInversees[i] = true;
+                for (int j = 0; j < nbVariablesOriginales; j++) {
+                    matriceContraintes[i][j] = -matriceContraintes[i][j];
+                }
+                T ancienL = l;
+                l = -u;
+                u = -ancienL;
+            }
+
+            if (!(EPSILON < u - l)) {
+                typesContraintes[i] = EQ;   // intervalle réduit à un point
+                Bi[i] = u;
+            } else {
+                ligneIntervalle[i] = true;
+                etendueLigne[i] = u - l;
+                typesContraintes[i] = (T(0) < l) ? GEQ : LEQ;
+                Bi[i] = (T(0) < l) ? l : u;
+            }
+            continue;
+        }
+
         if (Bi[i] < -EPSILON) {
+            lignesInversees[i] = true;
             for (int j = 0; j < nbVariablesOriginales; j++) {
                 matriceContraintes[i][j] = -matriceContraintes[i][j];
             }
@@ -60,60 +226,269 @@ SimplexSolver::SimplexSolver(const vector<double>& fobj,
     // Preprocess variables (handle s.r.s. and x <= 0)
     preprocessVariables();
 }
-void SimplexSolver::preprocessVariables() {
-    // Map original variables to new variables
-    variableMapping.clear();
-    variableMapping.resize(nbVariablesOriginales);
 
-    vector<double> newFonctionObjectif;
-    vector<vector<double>> newMatriceContraintes(nbContraintes);
+ProblemeLineaire::ControlePaire ProblemeLineaire::controlerPaire(const vector<double>& x, const vector<double>& y,
+                                                                 double tolerance) const {
+    int m = matriceContraintes.size();
+    int n = fonctionObjectif.size();
+
+    // Réalisabilité primale de x: signes puis contraintes
+    ControlePaire controle = {0.0, 0.0, 0.0, 0.0, false};
+    double normeB = 0.0;
+    for (int j = 0; j < n; j++) {
+        controle.valeurPrimal += fonctionObjectif[j] * x[j];
+        if (typesVariables[j] == NON_NEGATIVE) controle.residuPrimal = max(controle.residuPrimal, -x[j]);
+        if (typesVariables[j] == NON_POSITIVE) controle.residuPrimal = max(controle.residuPrimal, x[j]);
+    }
+    for (int i = 0; i < m; i++) {
+        double ax = 0.0;
+        for (int j = 0; j < n; j++) {
+            ax += matriceContraintes[i][j] * x[j];
+        }
+        double violation = ax - Bi[i];
+        if (typesContraintes[i] == GEQ) violation = -violation;
+        else if (typesContraintes[i] == EQ) violation = fabs(violation);
+        controle.residuPrimal = max(controle.residuPrimal, violation);
+        normeB = max(normeB, fabs(Bi[i]));
+        controle.valeurDual += Bi[i] * y[i];
+    }
 
-    int newVarIndex = 0;
+    controle.ecartDualite = fabs(controle.valeurPrimal - controle.valeurDual);
+    controle.verifiee = controle.ecartDualite <= tolerance * (1.0 + fabs(controle.valeurDual))
+                        && controle.residuPrimal <= tolerance * (1.0 + normeB);
+    return controle;
+}
 
-    for (int j = 0; j < nbVariablesOriginales; j++) {
-        variableMapping[j] = newVarIndex;
+ostream& fluxJournal(bool silencieux) {
+    if (!silencieux) return cout;
+    // Flux sans tampon: toute écriture est ignorée (un par thread)
+    thread_local ostream fluxNul(nullptr);
+    return fluxNul;
+}
 
-        if (typesVariables[j] == NON_NEGATIVE) {
-            // x_j >= 0: Keep as is
-            newFonctionObjectif.push_back(fonctionObjectif[j]);
-            for (int i = 0; i < nbContraintes; i++) {
-                newMatriceContraintes[i].push_back(matriceContraintes[i][j]);
-            }
-            newVarIndex++;
+template<typename T>
+bool SimplexSolverT<T>::arretDemande() const {
+    return drapeauArret != nullptr && drapeauArret->load(memory_order_relaxed);
+}
+
+template<typename T>
+bool SimplexSolverT<T>::limiteAtteinte() {
+    if (arretDemande()) {
+        causeArret = ARRET_ANNULATION;
+    } else if (limites.maxIterations > 0 && nbIterations >= limites.maxIterations) {
+        causeArret = ARRET_ITERATIONS;
+    } else if (limites.maxUnitesTravail > 0 && unitesTravail >= limites.maxUnitesTravail) {
+        causeArret = ARRET_UNITES_TRAVAIL;
+    } else if (limites.delaiMaxMs > 0 &&
+               chrono::duration<double, milli>(chrono::steady_clock::now() - debutResolution).count()
+                   >= limites.delaiMaxMs) {
+        causeArret = ARRET_DELAI;
+    } else {
+        return false;
+    }
+
+    interrompu = true;
+    etatSolution = LIMITE_ATTEINTE;
+    return true;
+}
 
-        } else if (typesVariables[j] == NON_POSITIVE) {
-            // x_j <= 0: Replace with x_j = -x'_j where x'_j >= 0
-            newFonctionObjectif.push_back(-fonctionObjectif[j]);
+template<typename T>
+void SimplexSolverT<T>::preprocessVariables() {
+    // Une colonne par variable d'origine, modifiée sur place:
+    //  - x <= 0 devient -x >= 0 (colonne et coût changés de signe);
+    //  - x s.r.s. reste une seule colonne libre: elle n'est jamais bloquée
+    //    au test du rapport, change de signe si elle doit décroître pour
+    //    entrer, et ne quitte plus la base une fois entrée.
+    nbVariablesDecision = nbVariablesOriginales;
+    colonneInversee.assign(nbVariablesDecision, false);
+    variableLibre.assign(nbVariablesDecision, false);
+    ensembleVariable.assign(nbVariablesDecision, -1);
+    pointsRupture.resize(nbVariablesDecision);
+    pentesMorceaux.resize(nbVariablesDecision);
+
+    for (int j = 0; j < nbVariablesOriginales; j++) {
+        if (typesVariables[j] == NON_POSITIVE) {
+            fonctionObjectif[j] = -fonctionObjectif[j];
             for (int i = 0; i < nbContraintes; i++) {
-                newMatriceContraintes[i].push_back(-matriceContraintes[i][j]);
+                matriceContraintes[i][j] = -matriceContraintes[i][j];
             }
-            newVarIndex++;
+            colonneInversee[j] = true;
+        } else if (typesVariables[j] == UNRESTRICTED) {
+            variableLibre[j] = true;
+        }
+    }
+}
 
-        } else { // UNRESTRICTED
-            // x_j s.r.s.: Replace with x_j = x'_j - x''_j where x'_j, x''_j >= 0
-            // Add x'_j
-            newFonctionObjectif.push_back(fonctionObjectif[j]);
-            for (int i = 0; i < nbContraintes; i++) {
-                newMatriceContraintes[i].push_back(matriceContraintes[i][j]);
+template<typename T>
+void SimplexSolverT<T>::setCoutParMorceaux(int j, const vector<double>& points, const vector<double>& pentes) {
+    if (j < 0 || j >= nbVariablesOriginales || typesVariables[j] != NON_NEGATIVE) {
+        throw invalid_argument("Cout par morceaux: variable inexistante ou non >= 0");
+    }
+    if (pentes.size() != points.size() + 1) {
+        throw invalid_argument("Cout par morceaux: une pente de plus que de points de rupture");
+    }
+
+    // Pentes ramenées au sens MIN: elles doivent croître (convexité)
+    Vecteur<T> p(1, T(0), &arene);
+    Vecteur<T> s(&arene);
+    for (size_t k = 0; k < pentes.size(); k++) {
+        T pente = TraitsScalaire<T>::depuisDouble(typeObj == MAX ? -pentes[k] : pentes[k]);
+        if (k < points.size()) {
+            T point = TraitsScalaire<T>::depuisDouble(points[k]);
+            if (!(p.back() < point)) throw invalid_argument("Cout par morceaux: points non croissants");
+            p.push_back(point);
+        }
+        if (k > 0 && pente < s.back()) {
+            throw invalid_argument(typeObj == MAX ? "Cout par morceaux non concave"
+                                                  : "Cout par morceaux non convexe");
+        }
+        s.push_back(pente);
+    }
+
+    if (pointsRupture[j].empty()) nbVariablesMorcelees++;
+    pointsRupture[j] = std::move(p);
+    pentesMorceaux[j] = std::move(s);
+    fonctionObjectif[j] = TraitsScalaire<T>::depuisDouble(pentes[0]);
+}
+
+template<typename T>
+void SimplexSolverT<T>::setCoutVariable(int j, double cout) {
+    if (j < 0 || j >= nbVariablesOriginales || estMorcelee(j)) {
+        throw invalid_argument("Cout: variable inexistante ou a cout par morceaux");
+    }
+    // Colonne transformée: -x_j si x_j <= 0 ou libre décroissante
+    T c = TraitsScalaire<T>::depuisDouble(cout);
+    fonctionObjectif[j] = colonneInversee[j] ? -c : c;
+}
+
+template<typename T>
+void SimplexSolverT<T>::inverserColonne(int colonne) {
+    // Variable libre qui doit décroître pour améliorer l'objectif: on
+    // travaille sur son opposée, qui elle croît
+    for (Vecteur<T>& ligne : tableau) {
+        ligne[colonne] = -ligne[colonne];
+    }
+    fonctionObjectif[colonne] = -fonctionObjectif[colonne];
+    for (int i = 0; i < nbContraintes; i++) {
+        matriceContraintes[i][colonne] = -matriceContraintes[i][colonne];
+    }
+    colonneInversee[colonne] = !colonneInversee[colonne];
+
+    string& nom = nomsVariables[colonne];
+    nom = (nom[0] == '-') ? nom.substr(1) : "-" + nom;
+    journal() << "Variable libre x" << (colonne + 1) << " decroissante: la colonne porte "
+         << nom << "\n";
+}
+
+template<typename T>
+void SimplexSolverT<T>::changerBorne(int colonne) {
+    // La colonne entrante atteint sa borne u avant toute variable de base:
+    // x = u - x' sans changement de base (x' hors base, à 0)
+    T u = borneColonne[colonne];
+    int nbColonnes = tableau[0].size() - 1;
+    for (Vecteur<T>& ligne : tableau) {
+        ligne[nbColonnes] -= u * ligne[colonne];
+        ligne[colonne] = -ligne[colonne];
+    }
+    unitesTravail += 2 * static_cast<long long>(tableau.size());
+    // Égalités au test du rapport: pas de second membre à peine négatif
+    for (int i = 0; i < nbContraintes; i++) {
+        if (!estLibre(base[i]) && tableau[i][nbColonnes] < T(0) && estZero(tableau[i][nbColonnes])) {
+            tableau[i][nbColonnes] = T(0);
+        }
+    }
+
+    colonneAuMax[colonne] = !colonneAuMax[colonne];
+    string& nom = nomsVariables[colonne];
+    nom = (nom[0] == '~') ? nom.substr(1) : "~" + nom;
+}
+
+template<typename T>
+void SimplexSolverT<T>::substituerBorneSortante(int ligne) {
+    // La variable de base x de la ligne atteint sa borne u: on la remplace
+    // par x' = u - x, qui sort ensuite à 0 par un pivot ordinaire. Les
+    // autres lignes ont un 0 dans sa colonne et ne changent pas.
+    int nbColonnes = tableau[0].size() - 1;
+    int colonne = base[ligne];
+    Vecteur<T>& l = tableau[ligne];
+    for (int j = 0; j < nbColonnes; j++) {
+        l[j] = -l[j];
+    }
+    l[colonne] = T(1);
+    T reste = borneColonne[colonne] - l[nbColonnes];
+    l[nbColonnes] = (reste < T(0)) ? T(0) : reste;
+    unitesTravail += nbColonnes + 1;
+
+    colonneAuMax[colonne] = !colonneAuMax[colonne];
+    string& nom = nomsVariables[colonne];
+    nom = (nom[0] == '~') ? nom.substr(1) : "~" + nom;
+}
+
+template<typename T>
+void SimplexSolverT<T>::extraireLignesGub() {
+    // Ligne GUB: <= à coefficients 0 ou 1, second membre > 0, dont les
+    // variables (>= 0, ni libres ni inversées) ne sont encore dans aucun
+    // ensemble. Elle quitte le modèle transformé; les autres lignes
+    // glissent vers le haut dans leur ordre.
+    int nouvelleLigne = 0;
+    bool enTete = false;
+    for (int i = 0; i < nbContraintes; i++) {
+        bool gub = typesContraintes[i] == LEQ && !ligneIntervalle[i] && EPSILON < Bi[i];
+        bool vide = true;
+        for (int j = 0; j < nbVariablesDecision && gub; j++) {
+            const T& a = matriceContraintes[i][j];
+            if (a == T(0)) continue;
+            if (!(a == T(1)) || variableLibre[j] || colonneInversee[j] || ensembleVariable[j] != -1 ||
+                estMorcelee(j)) {
+                gub = false;
             }
+            vide = false;
+        }
 
-            // Add x''_j
-            newFonctionObjectif.push_back(-fonctionObjectif[j]);
-            for (int i = 0; i < nbContraintes; i++) {
-                newMatriceContraintes[i].push_back(-matriceContraintes[i][j]);
+        if (gub && !vide) {
+            int k = secondMembreGub.size();
+            if (!enTete) {
+                journal() << "\n--- LIGNES GUB (hors du tableau, une variable cle par ensemble) ---\n";
+                enTete = true;
+            }
+            journal() << "  ";
+            bool premier = true;
+            for (int j = 0; j < nbVariablesDecision; j++) {
+                if (matriceContraintes[i][j] == T(0)) continue;
+                ensembleVariable[j] = k;
+                journal() << (premier ? "" : " + ") << nomVariableDecision(j);
+                premier = false;
             }
-            newVarIndex += 2;
+            journal() << " + g" << (k + 1) << " = " << Bi[i] << "\n";
+            secondMembreGub.push_back(Bi[i]);
+            continue;
         }
+
+        if (nouvelleLigne != i) {
+            matriceContraintes[nouvelleLigne] = std::move(matriceContraintes[i]);
+            Bi[nouvelleLigne] = Bi[i];
+            typesContraintes[nouvelleLigne] = typesContraintes[i];
+            lignesInversees[nouvelleLigne] = lignesInversees[i];
+            ligneIntervalle[nouvelleLigne] = ligneIntervalle[i];
+            etendueLigne[nouvelleLigne] = etendueLigne[i];
+        }
+        nouvelleLigne++;
     }
 
-    // Update problem data
-    fonctionObjectif = newFonctionObjectif;
-    matriceContraintes = newMatriceContraintes;
-    nbVariablesDecision = newFonctionObjectif.size();
+    if (nouvelleLigne == nbContraintes) return;
+    matriceContraintes.resize(nouvelleLigne);
+    Bi.resize(nouvelleLigne);
+    typesContraintes.resize(nouvelleLigne);
+    lignesInversees.resize(nouvelleLigne);
+    ligneIntervalle.resize(nouvelleLigne);
+    etendueLigne.resize(nouvelleLigne);
+    journal() << "Base de travail: " << nouvelleLigne << " ligne(s) sur "
+         << nbContraintes << "\n";
+    nbContraintes = nouvelleLigne;
 }
 
-
-void SimplexSolver::ajouterVariablesSupplementaires() {
+template<typename T>
+void SimplexSolverT<T>::ajouterVariablesSupplementaires() {
     int nbEcart = 0, nbExcedent = 0, nbArtif = 0;
 
     for (auto type : typesContraintes) {
@@ -122,23 +497,17 @@ void SimplexSolver::ajouterVariablesSupplementaires() {
         else nbArtif++;
     }
 
-    nbVariablesTotal = nbVariablesDecision + nbEcart + nbExcedent + nbArtif;
+    int nbEnsembles = secondMembreGub.size();
+    nbVariablesTotal = nbVariablesDecision + nbEcart + nbExcedent + nbArtif + nbEnsembles;
 
     nomsVariables.clear();
 
-    // Variables de décision (including transformed ones)
-    int varCount = 0;
+    // Variables de décision: une colonne chacune (-xj si xj <= 0)
     for (int j = 0; j < nbVariablesOriginales; j++) {
-        if (typesVariables[j] == UNRESTRICTED) {
-            nomsVariables.push_back("x" + to_string(j + 1) + "'");
-            nomsVariables.push_back("x" + to_string(j + 1) + "''");
-            varCount += 2;
-        } else if (typesVariables[j] == NON_POSITIVE) {
+        if (typesVariables[j] == NON_POSITIVE) {
             nomsVariables.push_back("-x" + to_string(j + 1));
-            varCount++;
         } else {
             nomsVariables.push_back("x" + to_string(j + 1));
-            varCount++;
         }
     }
 
@@ -156,38 +525,129 @@ void SimplexSolver::ajouterVariablesSupplementaires() {
             nomsVariables.push_back("w" + to_string(idxArtif++));
         }
     }
+
+    // Écarts des lignes GUB, en dernier
+    for (int k = 0; k < nbEnsembles; k++) {
+        nomsVariables.push_back("g" + to_string(k + 1));
+    }
+}
+
+template<typename T>
+void SimplexSolverT<T>::libererResolution() {
+    // Conteneurs vidés jusqu'à leur capacité: plus rien ne pointe dans
+    // l'arène de résolution quand elle rend ses blocs
+    auto vider = [](auto& conteneur) { std::decay_t<decltype(conteneur)>(conteneur.get_allocator()).swap(conteneur); };
+    vider(colonneBornee);
+    vider(borneColonne);
+    vider(colonneAuMax);
+    vider(ensembleColonne);
+    vider(cleGub);
+    vider(tauxCleGub);
+    vider(valeurCleGub);
+    vider(ancreMorceau);
+    vider(morceauDecroissant);
+    vider(pointsFranchis);
+    vider(tableau);
+    vider(base);
+    vider(nomsVariables);
+    vider(lignesArtificiellesEnBase);
+    vider(solutionOptimale);
+    vider(ligneColonne);
+    vider(colonneArtificielle);
+    vider(normeColonne);
+    vider(valeursControle);
+    vider(coutsControle);
+    vider(residusControle);
+    vider(baseReinversion);
+    vider(tableauReinversion);
+    vider(rayonFarkas);
+    vider(rayonNonBorne);
+    temporaires.release();
+    areneResolution.release();
 }
 
-void SimplexSolver::initialiserTableau() {
+template<typename T>
+void SimplexSolverT<T>::initialiserTableau() {
+    // Nouveau tableau: la résolution précédente rend toute sa mémoire
+    libererResolution();
     ajouterVariablesSupplementaires();
 
+    // Lignes remises à zéro: une résolution précédente a laissé les siennes
     tableau.resize(nbContraintes + 1);
     for (int i = 0; i <= nbContraintes; i++) {
-        tableau[i].resize(nbVariablesTotal + 1, 0.0);
+        tableau[i].assign(nbVariablesTotal + 1, T(0));
     }
 
     base.resize(nbContraintes);
     int colActuelle = nbVariablesDecision;
     nbVariablesArtificielles = 0;
+    lignesArtificiellesEnBase.clear();
+
+    colonneBornee.assign(nbVariablesTotal, false);
+    borneColonne.assign(nbVariablesTotal, T(0));
+    colonneAuMax.assign(nbVariablesTotal, false);
+
+    // Au départ chaque écart g_k est la clé de son ensemble: sa colonne
+    // est nulle dans les lignes de travail, celles des membres inchangées
+    int nbEnsembles = secondMembreGub.size();
+    ensembleColonne.assign(nbVariablesTotal, -1);
+    for (int j = 0; j < nbVariablesDecision; j++) {
+        ensembleColonne[j] = ensembleVariable[j];
+    }
+    cleGub.resize(nbEnsembles);
+    for (int k = 0; k < nbEnsembles; k++) {
+        cleGub[k] = nbVariablesTotal - nbEnsembles + k;
+        ensembleColonne[cleGub[k]] = k;
+    }
+    tauxCleGub.assign(nbEnsembles, T(0));
+    valeurCleGub.assign(nbEnsembles, T(0));
+
+    // Ligne d'origine des colonnes d'écart et artificielles (réinversion)
+    ligneColonne.assign(nbVariablesTotal, -1);
+    colonneArtificielle.assign(nbVariablesTotal, false);
+    normeColonne.assign(nbVariablesTotal, T(1));
+    for (int j = 0; j < nbVariablesDecision; j++) {
+        normeColonne[j] = T(0);
+        for (int i = 0; i < nbContraintes; i++) {
+            normeColonne[j] += TraitsScalaire<T>::abs(matriceContraintes[i][j]);
+        }
+    }
+
+    // Coûts par morceaux: ancrés à 0 jusqu'à la phase 2
+    ancreMorceau.assign(nbVariablesDecision, 0);
+    morceauDecroissant.assign(nbVariablesDecision, false);
+    coutsParMorceauxActifs = false;
 
     for (int i = 0; i < nbContraintes; i++) {
         for (int j = 0; j < nbVariablesDecision; j++) {
             tableau[i][j] = matriceContraintes[i][j];
         }
 
+        // Écart (LEQ) ou excédent (GEQ) d'une ligne RANGE: borné
+        if (ligneIntervalle[i]) {
+            colonneBornee[colActuelle] = true;
+            borneColonne[colActuelle] = etendueLigne[i];
+        }
+
         if (typesContraintes[i] == LEQ) {
-            tableau[i][colActuelle] = 1.0;
+            tableau[i][colActuelle] = T(1);
+            ligneColonne[colActuelle] = i;
             base[i] = colActuelle;
             colActuelle++;
         } else if (typesContraintes[i] == GEQ) {
-            tableau[i][colActuelle] = -1.0;
+            tableau[i][colActuelle] = T(-1);
+            ligneColonne[colActuelle] = i;
             colActuelle++;
-            tableau[i][colActuelle] = 1.0;
+            tableau[i][colActuelle] = T(1);
+            ligneColonne[colActuelle] = i;
+            colonneArtificielle[colActuelle] = true;
             base[i] = colActuelle;
             nbVariablesArtificielles++;
             colActuelle++;
         } else {
-            tableau[i][colActuelle] = 1.0;
+            tableau[i][colActuelle] = T(1);
+            ligneColonne[colActuelle] = i;
+            colonneArtificielle[colActuelle] = true;
             base[i] = colActuelle;
             nbVariablesArtificielles++;
             colActuelle++;
@@ -197,64 +657,49 @@ void SimplexSolver::initialiserTableau() {
     }
 }
 
-void SimplexSolver::phase1() {
+template<typename T>
+void SimplexSolverT<T>::phase1() {
     if (nbVariablesArtificielles == 0) return;
 
-    cout << "\n=== PHASE 1: Elimination des variables artificielles ===\n";
-    cout << "Objectif: Min W = somme des variables artificielles\n";
-
     // Identify artificial variables
-    vector<bool> estArtificielle(nbVariablesTotal, false);
-    int colActuelle = nbVariablesDecision;
+    Vecteur<bool> estArtificielle = colonnesArtificielles();
 
-    for (int i = 0; i < nbContraintes; i++) {
-        if (typesContraintes[i] == LEQ) {
-            colActuelle++;
-        } else if (typesContraintes[i] == GEQ) {
-            colActuelle++;
-            estArtificielle[colActuelle] = true;
-            colActuelle++;
-        } else { // EQ
-            estArtificielle[colActuelle] = true;
-            colActuelle++;
+    if (crashActif) {
+        crashBase(estArtificielle);
+
+        bool resteArtificielle = false;
+        for (int i = 0; i < nbContraintes; i++) {
+            if (estArtificielle[base[i]]) resteArtificielle = true;
+        }
+        if (!resteArtificielle) {
+            journal() << "\nAucune variable artificielle en base: phase 1 inutile.\n";
+            return;
         }
     }
 
-    // Initialize Phase 1 objective: MIN W = sum of artificial variables
-    for (int j = 0; j < nbVariablesTotal; j++) {
-        tableau[nbContraintes][j] = estArtificielle[j] ? 1.0 : 0.0;
-    }
-    tableau[nbContraintes][nbVariablesTotal] = 0.0;
+    journal() << "\n=== PHASE 1: Elimination des variables artificielles ===\n";
+    journal() << "Objectif: Min W = somme des variables artificielles\n";
 
-    // Make artificial variables in base have coefficient 0
-    for (int i = 0; i < nbContraintes; i++) {
-        if (base[i] < nbVariablesTotal && estArtificielle[base[i]]) {
-            for (int j = 0; j <= nbVariablesTotal; j++) {
-                tableau[nbContraintes][j] -= tableau[i][j];
-            }
-        }
-    }
+    initialiserObjectifPhase1(estArtificielle);
+    phaseRealisabilite = true;
 
     int iteration = 0;
     afficherTableau(iteration++, true);
 
-    while (!estOptimal(true)) {
+    while (!optimumConfirme(true)) {
+        if (limiteAtteinte()) return;
+
         int colPivot = trouverColonnePivot(true);
         if (colPivot == -1) break;
+        orienterColonneEntrante(colPivot);
 
         if (estNonBorne(colPivot)) {
             etatSolution = INFAISABLE;
             return;
         }
 
-        int lignePivot = trouverLignePivot(colPivot);
-
-        cout << "\nIteration " << iteration << ": Variable entrante = "
-             << nomsVariables[colPivot] << ", Variable sortante = "
-             << nomsVariables[base[lignePivot]] << endl;
-
-        pivoter(lignePivot, colPivot);
-        base[lignePivot] = colPivot;
+        avancer(colPivot, iteration);
+        controlerSante(false);
 
         afficherTableau(iteration++, true);
     }
@@ -262,11 +707,11 @@ void SimplexSolver::phase1() {
     // ✅ فحص قوي للـ Infeasibility
 
     // الفحص 1: قيمة W يجب أن تكون صفر
-    if (abs(tableau[nbContraintes][nbVariablesTotal]) > EPSILON) {
-        cout << "\n*** Phase 1 ECHEC: W = "
+    if (TraitsScalaire<T>::abs(tableau[nbContraintes][nbVariablesTotal]) > EPSILON) {
+        journal() << "\n*** Phase 1 ECHEC: W = "
              << tableau[nbContraintes][nbVariablesTotal]
              << " > 0 ***\n";
-        cout << "Les contraintes sont incompatibles!\n";
+        journal() << "Les contraintes sont incompatibles!\n";
         etatSolution = INFAISABLE;
         return;
     }
@@ -274,42 +719,285 @@ void SimplexSolver::phase1() {
     // ✅ الفحص 2: لا يجب أن تبقى متغيرات صناعية في القاعدة بقيمة > 0
     for (int i = 0; i < nbContraintes; i++) {
         if (base[i] < nbVariablesTotal && estArtificielle[base[i]]) {
-            double valeurBase = tableau[i][nbVariablesTotal];
+            T valeurBase = tableau[i][nbVariablesTotal];
             if (valeurBase > EPSILON) {
-                cout << "\n*** Phase 1 ECHEC: Variable artificielle "
+                journal() << "\n*** Phase 1 ECHEC: Variable artificielle "
                      << nomsVariables[base[i]]
                      << " reste dans la base avec valeur = "
                      << valeurBase << " > 0 ***\n";
-                cout << "Les contraintes sont incompatibles!\n";
+                journal() << "Les contraintes sont incompatibles!\n";
                 etatSolution = INFAISABLE;
                 return;
             }
         }
     }
 
-    cout << "\nPhase 1 terminee: W = 0, Solution realisable trouvee!\n";
+    journal() << "\nPhase 1 terminee: W = 0, Solution realisable trouvee!\n";
 
     // ✅ الفحص 3 (اختياري): تحذير إذا كانت متغيرات صناعية في القاعدة بقيمة صفر
     bool warningArtificielles = false;
     for (int i = 0; i < nbContraintes; i++) {
         if (base[i] < nbVariablesTotal && estArtificielle[base[i]]) {
             if (!warningArtificielles) {
-                cout << "\n⚠️  ATTENTION: Les variables artificielles suivantes restent dans la base (avec valeur 0):\n";
+                journal() << "\n⚠️  ATTENTION: Les variables artificielles suivantes restent dans la base (avec valeur 0):\n";
                 warningArtificielles = true;
             }
-            cout << "  - " << nomsVariables[base[i]] << " (ligne " << (i+1) << ")\n";
+            journal() << "  - " << nomsVariables[base[i]] << " (ligne " << (i+1) << ")\n";
         }
     }
     if (warningArtificielles) {
-        cout << "Cela peut indiquer une redondance dans les contraintes.\n";
+        journal() << "Cela peut indiquer une redondance dans les contraintes.\n";
+    }
+}
+
+template<typename T>
+void SimplexSolverT<T>::initialiserObjectifPhase1(const Vecteur<bool>& estArtificielle) {
+    // Initialize Phase 1 objective: MIN W = sum of artificial variables
+    for (int j = 0; j < nbVariablesTotal; j++) {
+        tableau[nbContraintes][j] = estArtificielle[j] ? T(1) : T(0);
+    }
+    tableau[nbContraintes][nbVariablesTotal] = T(0);
+
+    // Make artificial variables in base have coefficient 0
+    for (int i = 0; i < nbContraintes; i++) {
+        if (base[i] < nbVariablesTotal && estArtificielle[base[i]]) {
+            for (int j = 0; j <= nbVariablesTotal; j++) {
+                tableau[nbContraintes][j] -= tableau[i][j];
+            }
+        }
+    }
+}
+
+template<typename T>
+void SimplexSolverT<T>::phaseComposite() {
+    Vecteur<bool> estArtificielle = colonnesArtificielles();
+    if (crashActif) crashBase(estArtificielle);
+
+    journal() << "\n=== METHODE COMPOSITE: realisabilite et optimalite en une seule phase ===\n";
+    journal() << "Objectif: Min poids * W + Z (W = somme des variables artificielles)\n";
+
+    // Ligne W à sa place habituelle; la ligne des coûts de phase 2 est
+    // ajoutée dessous et suit tous les pivots: rien à reconstruire ensuite
+    int ligneW = nbContraintes;
+    int ligneZ = nbContraintes + 1;
+    initialiserObjectifPhase1(estArtificielle);
+    tableau.emplace_back(nbVariablesTotal + 1, T(0));
+    calculerLigneCouts(ligneZ);
+    phaseRealisabilite = true;
+
+    // Poids initial à l'échelle des coûts, augmenté quand aucune colonne
+    // n'améliore la combinaison alors que W peut encore décroître
+    T poids = T(1);
+    for (int j = 0; j < nbVariablesTotal; j++) {
+        T c = TraitsScalaire<T>::abs(tableau[ligneZ][j]);
+        if (poids < c) poids = c;
+    }
+    // Rayon de récession rencontré avant la réalisabilité: on termine en
+    // pure phase 1, la phase 2 conclura à la non-bornitude
+    bool phase1Seule = false;
+
+    int iteration = 0;
+    afficherTableau(iteration++, true);
+
+    while (!estZero(tableau[ligneW][nbVariablesTotal])) {
+        if (limiteAtteinte()) return;
+
+        // Les artificielles sorties de la base n'y reviennent pas
+        int colPivot = -1;
+        T meilleur = -EPSILON;
+        bool wPeutDecroitre = false;
+        for (int j = 0; j < nbVariablesTotal; j++) {
+            if (estArtificielle[j]) continue;
+            T dW = tableau[ligneW][j];
+            T d = phase1Seule ? dW : poids * dW + tableau[ligneZ][j];
+            // Variable libre: elle peut aussi décroître
+            if (estLibre(j)) {
+                if (T(0) < dW) dW = -dW;
+                if (T(0) < d) d = -d;
+            }
+            if (dW < -EPSILON) wPeutDecroitre = true;
+            if (d < meilleur) {
+                colPivot = j;
+                if (regleBland) break;
+                meilleur = d;
+            }
+        }
+
+        if (!wPeutDecroitre) {
+            journal() << "\n*** W = " << -tableau[ligneW][nbVariablesTotal]
+                 << " > 0 ne peut plus decroitre: les contraintes sont incompatibles! ***\n";
+            etatSolution = INFAISABLE;
+            return;
+        }
+
+        if (colPivot == -1) {
+            poids *= T(10);
+            journal() << "Aucune colonne n'ameliore la combinaison: poids = " << poids << "\n";
+            continue;
+        }
+        T dChoisi = phase1Seule ? tableau[ligneW][colPivot]
+                                : poids * tableau[ligneW][colPivot] + tableau[ligneZ][colPivot];
+        if (T(0) < dChoisi) inverserColonne(colPivot);
+
+        if (estNonBorne(colPivot)) {
+            // Le long d'un rayon W ne décroît pas: c'est le coût qui attire
+            if (phase1Seule) {
+                etatSolution = INFAISABLE;
+                return;
+            }
+            T dW = tableau[ligneW][colPivot];
+            if (dW > EPSILON) {
+                T poidsMin = -tableau[ligneZ][colPivot] / dW;
+                poids = (poids * T(10) < poidsMin * T(2)) ? poidsMin * T(2) : poids * T(10);
+                journal() << "Rayon sur " << nomsVariables[colPivot] << ": poids = " << poids << "\n";
+            } else {
+                journal() << "Rayon de recession sur " << nomsVariables[colPivot]
+                     << ": fin de la recherche de realisabilite en phase 1 pure\n";
+                phase1Seule = true;
+            }
+            continue;
+        }
+
+        avancer(colPivot, iteration);
+        controlerSante(false);
+
+        afficherTableau(iteration++, true);
+    }
+
+    journal() << "\nW = 0: solution realisable, la ligne des couts est deja a jour.\n";
+
+    // La ligne des coûts prend la place de la ligne W
+    tableau[ligneW] = std::move(tableau[ligneZ]);
+    tableau.pop_back();
+    phaseRealisabilite = false;
+    nbPivotsDegeneresConsecutifs = 0;
+    regleBland = false;
+}
+
+template<typename T>
+void SimplexSolverT<T>::crashBase(const Vecteur<bool>& estArtificielle) {
+    // Crash triangulaire: chaque ligne dont la variable de base est
+    // artificielle reçoit, si possible, une colonne hors base (non
+    // artificielle) qui remporte le test du rapport sur cette ligne. Le
+    // pivot fait sortir l'artificielle sans rendre un second membre négatif.
+    // Ordre LTSF: lignes ayant le moins de candidates d'abord; parmi les
+    // colonnes admissibles, celle qui touche le moins de lignes encore à
+    // couvrir (la base reste triangulaire), puis la moins chère pour
+    // l'objectif de phase 2, puis le plus grand pivot.
+    int nbColonnes = nbVariablesTotal;
+    T seuilRelatif = TraitsScalaire<T>::depuisDouble(SEUIL_PIVOT_CRASH);
+
+    Vecteur<bool> dansBase(nbVariablesTotal, false, &temporaires);
+    Vecteur<bool> aCouvrir(nbContraintes, false, &temporaires);
+    Vecteur<int> nbCandidates(nbContraintes, 0, &temporaires);
+    Vecteur<int> lignes(&temporaires);
+    for (int i = 0; i < nbContraintes; i++) {
+        dansBase[base[i]] = true;
+        if (!estArtificielle[base[i]]) continue;
+        aCouvrir[i] = true;
+        lignes.push_back(i);
+        for (int j = 0; j < nbColonnes; j++) {
+            if (!estArtificielle[j] && !estZero(tableau[i][j])) nbCandidates[i]++;
+        }
+    }
+    // std::sort plutôt que stable_sort, qui alloue hors de l'arène
+    sort(lignes.begin(), lignes.end(), [&](int a, int b) {
+        return nbCandidates[a] < nbCandidates[b] || (nbCandidates[a] == nbCandidates[b] && a < b);
+    });
+
+    bool enTete = false;
+    for (int i : lignes) {
+        const T& bi = tableau[i][nbColonnes];
+        int colonne = -1;
+        int meilleurContact = 0;
+        T meilleurPivot = T(0);
+        T meilleurCout = T(0);
+
+        for (int j = 0; j < nbColonnes; j++) {
+            // Un membre d'ensemble GUB ferait varier sa clé
+            if (estArtificielle[j] || dansBase[j] || ensembleColonne[j] != -1) continue;
+            const T& a = tableau[i][j];
+            if (estZero(a)) continue;
+            // Second membre nul: le pivot est dégénéré, tout signe convient
+            if (a < T(0) && !estZero(bi)) continue;
+            // Écart borné: il entrerait au-delà de sa borne
+            if (estBornee(j) && !estZero(bi) && borneColonne[j] * a < bi) continue;
+
+            T maxColonne = T(0);
+            int contact = 0;
+            bool admissible = true;
+            for (int k = 0; k < nbContraintes && admissible; k++) {
+                T v = TraitsScalaire<T>::abs(tableau[k][j]);
+                if (maxColonne < v) maxColonne = v;
+                if (k == i || estLibre(base[k])) continue;
+                if (aCouvrir[k] && !estZero(tableau[k][j])) contact++;
+                // Une autre ligne atteindrait zéro avant la ligne i (même
+                // un coefficient sous EPSILON peut la rendre négative)
+                if (!estZero(bi) && tableau[k][j] > T(0) &&
+                    tableau[k][nbColonnes] * a < bi * tableau[k][j]) {
+                    admissible = false;
+                }
+                // ... ou une variable de base bornée dépasserait sa borne
+                if (!estZero(bi) && tableau[k][j] < T(0) && estBornee(base[k]) &&
+                    (borneColonne[base[k]] - tableau[k][nbColonnes]) * a < -(bi * tableau[k][j])) {
+                    admissible = false;
+                }
+            }
+            if (!admissible || TraitsScalaire<T>::abs(a) < seuilRelatif * maxColonne) continue;
+
+            T pivot = TraitsScalaire<T>::abs(a);
+            T coutColonne = T(0);
+            if (j < nbVariablesDecision) coutColonne = (typeObj == MAX) ? -fonctionObjectif[j] : fonctionObjectif[j];
+            if (colonne == -1 || contact < meilleurContact ||
+                (contact == meilleurContact && (coutColonne < meilleurCout ||
+                 (!(meilleurCout < coutColonne) && meilleurPivot < pivot)))) {
+                colonne = j;
+                meilleurContact = contact;
+                meilleurPivot = pivot;
+                meilleurCout = coutColonne;
+            }
+        }
+
+        if (colonne == -1) continue;
+
+        if (!enTete) {
+            journal() << "\n--- BASE DE DEPART (crash) ---\n";
+            enTete = true;
+        }
+        journal() << "  " << nomsVariables[colonne] << " remplace "
+             << nomsVariables[base[i]] << " (ligne " << (i + 1) << ")\n";
+
+        if (estZero(bi)) tableau[i][nbColonnes] = T(0);   // voir sortirArtificiellesDeLaBase
+        pivoter(i, colonne);
+        // Égalités au test du rapport: l'arrondi peut laisser un second
+        // membre à peine négatif, que le test du rapport ignorerait ensuite
+        for (int k = 0; k < nbContraintes; k++) {
+            if (!estLibre(base[k]) && tableau[k][nbColonnes] < T(0) && estZero(tableau[k][nbColonnes])) {
+                tableau[k][nbColonnes] = T(0);
+            }
+        }
+        dansBase[base[i]] = false;
+        dansBase[colonne] = true;
+        base[i] = colonne;
+        aCouvrir[i] = false;
+        nbPivotsCrash++;
     }
 }
 
-void SimplexSolver::phase2() {
-    cout << "\n=== PHASE 2: Optimisation de la fonction objectif ===\n";
+template<typename T>
+void SimplexSolverT<T>::phase2() {
+    journal() << "\n=== PHASE 2: Optimisation de la fonction objectif ===\n";
+
+    sortirArtificiellesDeLaBase();
+    retirerVariablesArtificielles();
+    // En mode composite, la ligne des coûts a suivi tous les pivots
+    if (!(modeComposite && nbVariablesArtificielles > 0 && nbVariablesMorcelees == 0)) initialiserObjectifPhase2();
+    iterationsPhase2();
+}
 
-    // Identify artificial variables and remove them
-    vector<bool> estArtificielle(nbVariablesTotal, false);
+template<typename T>
+typename SimplexSolverT<T>::template Vecteur<bool> SimplexSolverT<T>::colonnesArtificielles() {
+    Vecteur<bool> estArtificielle(nbVariablesTotal, false, &temporaires);
     int colActuelle = nbVariablesDecision;
 
     for (int i = 0; i < nbContraintes; i++) {
@@ -324,9 +1012,54 @@ void SimplexSolver::phase2() {
             colActuelle++;
         }
     }
+    return estArtificielle;
+}
+
+template<typename T>
+void SimplexSolverT<T>::sortirArtificiellesDeLaBase() {
+    // Après la phase 1, une artificielle encore en base vaut 0: un pivot
+    // dégénéré sur n'importe quel coefficient non nul de sa ligne (hors
+    // artificielles) la remplace sans changer la solution. Si la ligne
+    // n'en a aucun, la contrainte est redondante.
+    Vecteur<bool> estArtificielle = colonnesArtificielles();
+
+    for (int i = 0; i < nbContraintes; i++) {
+        if (!estArtificielle[base[i]]) continue;
+
+        int colonne = -1;
+        T maxVal = T(0);
+        for (int j = 0; j < nbVariablesTotal; j++) {
+            if (estArtificielle[j]) continue;
+            T val = TraitsScalaire<T>::abs(tableau[i][j]);
+            if (val > EPSILON && (colonne == -1 || val > maxVal)) {
+                maxVal = val;
+                colonne = j;
+            }
+        }
+
+        if (colonne == -1) {
+            journal() << "Ligne " << (i + 1) << " redondante: " << nomsVariables[base[i]]
+                 << " reste a 0 et la ligne est ignoree\n";
+            continue;
+        }
+
+        journal() << "Pivot degenere: " << nomsVariables[colonne]
+             << " remplace " << nomsVariables[base[i]] << " (ligne " << (i + 1) << ")\n";
+        // Niveau nul à EPSILON près: sans remise à zéro exacte, un pivot
+        // négatif donnerait une valeur de base négative que le test du
+        // rapport ignorerait ensuite
+        tableau[i][nbVariablesTotal] = T(0);
+        pivoter(i, colonne);
+        base[i] = colonne;
+    }
+}
+
+template<typename T>
+void SimplexSolverT<T>::retirerVariablesArtificielles() {
+    Vecteur<bool> estArtificielle = colonnesArtificielles();
 
-    // Create new tableau without artificial variables
-    vector<int> nouvelIndice(nbVariablesTotal, -1);
+    // Compactage sur place: chaque colonne conservée glisse vers la gauche
+    Vecteur<int> nouvelIndice(nbVariablesTotal, -1, &temporaires);
     int nouvelleCol = 0;
     for (int j = 0; j < nbVariablesTotal; j++) {
         if (!estArtificielle[j]) {
@@ -336,133 +1069,311 @@ void SimplexSolver::phase2() {
 
     int nbVariablesSansArtif = nouvelleCol;
 
-    vector<vector<double>> nouveauTableau(nbContraintes + 1);
     for (int i = 0; i <= nbContraintes; i++) {
-        nouveauTableau[i].resize(nbVariablesSansArtif + 1, 0.0);
-    }
-
-    // Copy constraint rows (without artificial columns)
-    for (int i = 0; i < nbContraintes; i++) {
         for (int j = 0; j < nbVariablesTotal; j++) {
             if (!estArtificielle[j]) {
-                nouveauTableau[i][nouvelIndice[j]] = tableau[i][j];
+                tableau[i][nouvelIndice[j]] = tableau[i][j];
             }
         }
-        nouveauTableau[i][nbVariablesSansArtif] = tableau[i][nbVariablesTotal];
+        tableau[i][nbVariablesSansArtif] = tableau[i][nbVariablesTotal];
+        tableau[i].resize(nbVariablesSansArtif + 1);
     }
 
-    // Update base indices
+    // Une ligne dont la variable de base était artificielle n'a plus de
+    // variable de base (-1): ligne redondante, ou base à refactoriser
+    // dans solveDepuisBase
     for (int i = 0; i < nbContraintes; i++) {
-        if (base[i] < nbVariablesTotal && !estArtificielle[base[i]]) {
-            base[i] = nouvelIndice[base[i]];
-        }
+        if (estArtificielle[base[i]]) lignesArtificiellesEnBase.push_back(ligneColonne[base[i]]);
+        base[i] = estArtificielle[base[i]] ? -1 : nouvelIndice[base[i]];
     }
 
-    // Update variable names
-    vector<string> nouveauxNoms;
     for (int j = 0; j < nbVariablesTotal; j++) {
-        if (!estArtificielle[j]) {
-            nouveauxNoms.push_back(nomsVariables[j]);
+        if (!estArtificielle[j] && nouvelIndice[j] != j) {
+            nomsVariables[nouvelIndice[j]] = std::move(nomsVariables[j]);
+            colonneBornee[nouvelIndice[j]] = colonneBornee[j];
+            borneColonne[nouvelIndice[j]] = borneColonne[j];
+            colonneAuMax[nouvelIndice[j]] = colonneAuMax[j];
+            ensembleColonne[nouvelIndice[j]] = ensembleColonne[j];
+            ligneColonne[nouvelIndice[j]] = ligneColonne[j];
+            colonneArtificielle[nouvelIndice[j]] = colonneArtificielle[j];
+            normeColonne[nouvelIndice[j]] = normeColonne[j];
         }
     }
-    nomsVariables = nouveauxNoms;
-    tableau = nouveauTableau;
+    for (int& cle : cleGub) {
+        cle = nouvelIndice[cle];
+    }
+    nomsVariables.resize(nbVariablesSansArtif);
+    colonneBornee.resize(nbVariablesSansArtif);
+    borneColonne.resize(nbVariablesSansArtif);
+    colonneAuMax.resize(nbVariablesSansArtif);
+    ensembleColonne.resize(nbVariablesSansArtif);
+    ligneColonne.resize(nbVariablesSansArtif);
+    colonneArtificielle.resize(nbVariablesSansArtif);
+    normeColonne.resize(nbVariablesSansArtif);
     nbVariablesTotal = nbVariablesSansArtif;
+}
+
+template<typename T>
+void SimplexSolverT<T>::initialiserObjectifPhase2() {
+    // Nouvel objectif: la détection de stagnation repart de zéro
+    nbPivotsDegeneresConsecutifs = 0;
+    regleBland = false;
+    phaseRealisabilite = false;
+
+    activerCoutsParMorceaux();
+    calculerLigneCouts(nbContraintes);
+}
 
+template<typename T>
+void SimplexSolverT<T>::calculerLigneCouts(int ligne) {
     // **CRITICAL FIX**: Initialize Phase 2 objective row correctly
     for (int j = 0; j <= nbVariablesTotal; j++) {
-        tableau[nbContraintes][j] = 0.0;
+        tableau[ligne][j] = T(0);
     }
 
     // ✅ Store -c_j for both MAX and MIN after transformation
     // This creates a unified MIN problem: MIN (-Z) for MAX, MIN Z for MIN
+    // Ensembles GUB: x_cle = b_k - (autres membres), d'où les coûts
+    // c_j - c_cle et la constante sum c_cle * b_k
+    for (int j = 0; j < nbVariablesTotal; j++) {
+        tableau[ligne][j] = coutTransforme(j);
+    }
+    for (int k = 0; k < static_cast<int>(cleGub.size()); k++) {
+        tableau[ligne][nbVariablesTotal] -= coutPhase2(cleGub[k]) * secondMembreGub[k];
+    }
+    // Coût par morceaux: valeur au point d'ancrage, plus la pente du
+    // segment courant fois v
     for (int j = 0; j < nbVariablesDecision; j++) {
-        if (typeObj == MAX) {
-            tableau[nbContraintes][j] = -fonctionObjectif[j];  // MIN (-Z)
-        } else {
-            tableau[nbContraintes][j] = fonctionObjectif[j];   // MIN Z
-        }
+        if (estMorcelee(j)) tableau[ligne][nbVariablesTotal] -= valeurAuPoint(j, ancreMorceau[j]);
     }
 
     // Adjust for basic variables using row operations
     for (int i = 0; i < nbContraintes; i++) {
-        if (base[i] < nbVariablesDecision) {
-            double coefBase;
-            if (typeObj == MAX) {
-                coefBase = -fonctionObjectif[base[i]];  // MIN (-Z)
-            } else {
-                coefBase = fonctionObjectif[base[i]];   // MIN Z
-            }
+        if (base[i] >= 0) {
+            T coefBase = coutTransforme(base[i]);
 
             if (!estZero(coefBase)) {
                 for (int j = 0; j <= nbVariablesTotal; j++) {
-                    tableau[nbContraintes][j] -= coefBase * tableau[i][j];
+                    tableau[ligne][j] -= coefBase * tableau[i][j];
                 }
             }
         }
     }
+}
 
-    int iteration = 0;
-    afficherTableau(iteration++);
-
-    while (!estOptimal(false)) {
-        int colPivot = trouverColonnePivot(false);
-        if (colPivot == -1) break;
+template<typename T>
+T SimplexSolverT<T>::coutPhase2(int j) const {
+    if (j >= nbVariablesDecision) return T(0);
+    if (estMorcelee(j)) {
+        const T& pente = pentesMorceaux[j][segmentMorceau(j)];
+        return morceauDecroissant[j] ? -pente : pente;
+    }
+    return (typeObj == MAX) ? -fonctionObjectif[j] : fonctionObjectif[j];
+}
 
-        if (estNonBorne(colPivot)) {
-            etatSolution = NON_BORNE;
-            return;
-        }
+template<typename T>
+T SimplexSolverT<T>::coutTransforme(int j) const {
+    int k = ensembleColonne[j];
+    return (k == -1) ? coutPhase2(j) : coutPhase2(j) - coutPhase2(cleGub[k]);
+}
 
-        int lignePivot = trouverLignePivot(colPivot);
+template<typename T>
+void SimplexSolverT<T>::activerCoutsParMorceaux() {
+    // Fin de la phase 1 (où x_j >= 0 suffisait): chaque variable en base
+    // est ancrée au point de rupture qui précède sa valeur, v = x - p_r
+    if (nbVariablesMorcelees == 0 || coutsParMorceauxActifs) return;
+    int nbColonnes = tableau[0].size() - 1;
+    for (int i = 0; i < nbContraintes; i++) {
+        int j = base[i];
+        if (!estMorcelee(j)) continue;
+        const Vecteur<T>& points = pointsRupture[j];
+        T& v = tableau[i][nbColonnes];
+        int r = 0;
+        while (r + 1 < static_cast<int>(points.size()) && !(v < points[r + 1])) r++;
+        v -= points[r];
+        if (v < T(0)) v = T(0);
+        ancreMorceau[j] = r;
+    }
+    coutsParMorceauxActifs = true;
+}
 
-        cout << "\nIteration " << iteration << ": Variable entrante = "
-             << nomsVariables[colPivot] << ", Variable sortante = "
-             << nomsVariables[base[lignePivot]] << endl;
+template<typename T>
+T SimplexSolverT<T>::valeurAuPoint(int j, int point) const {
+    // Coût (sens MIN) de x_j au point de rupture donné
+    T valeur = T(0);
+    for (int k = 0; k < point; k++) {
+        valeur += pentesMorceaux[j][k] * (pointsRupture[j][k + 1] - pointsRupture[j][k]);
+    }
+    return valeur;
+}
 
-        pivoter(lignePivot, colPivot);
-        base[lignePivot] = colPivot;
+template<typename T>
+T SimplexSolverT<T>::coutReduitMorceau(int j) const {
+    // Hors base, au point d'ancrage: continuer dans le sens de la colonne
+    // (d) ou repartir dans l'autre, de coût -d + saut de pente au point.
+    // En base, d = 0 et le saut est >= 0: rien à gagner.
+    const T& d = tableau[nbContraintes][j];
+    int r = ancreMorceau[j];
+    if (!morceauDecroissant[j] && r == 0) return d;   // x_j = 0: pas de retour
+    T saut = pentesMorceaux[j][r] - pentesMorceaux[j][r - 1];
+    T inverse = saut - d;
+    return (inverse < d) ? inverse : d;
+}
 
-        afficherTableau(iteration++);
+template<typename T>
+void SimplexSolverT<T>::orienterColonneEntrante(int colPivot) {
+    const T& d = tableau[nbContraintes][colPivot];
+    if (estMorceleeActive(colPivot)) {
+        if (coutReduitMorceau(colPivot) < d) {
+            reancrerMorceau(colPivot, ancreMorceau[colPivot], !morceauDecroissant[colPivot]);
+        }
+    } else if (T(0) < d) {
+        inverserColonne(colPivot);
     }
-
-    etatSolution = OPTIMALE;
 }
 
-bool SimplexSolver::estOptimal(bool isPhase1) {
-    int nbColonnes = tableau[0].size() - 1;
+template<typename T>
+void SimplexSolverT<T>::reancrerMorceau(int j, int point, bool decroissant) {
+    // x_j = p_r + s v = p_point + s' v'  =>  v = delta + rho v', puis la
+    // pente de v' remplace celle de v dans la ligne des coûts
+    const Vecteur<T>& points = pointsRupture[j];
+    T delta = points[point] - points[ancreMorceau[j]];
+    if (morceauDecroissant[j]) delta = -delta;
+    bool inverse = decroissant != morceauDecroissant[j];
+    T coutAvant = inverse ? -coutPhase2(j) : coutPhase2(j);
+    ancreMorceau[j] = point;
+    morceauDecroissant[j] = decroissant;
+    T hausse = coutPhase2(j) - coutAvant;
+
+    int nbColonnes = tableau[0].size() - 1;
+    Vecteur<T>& couts = tableau[nbContraintes];
+    int ligne = -1;
+    for (int i = 0; i < nbContraintes && ligne == -1; i++) {
+        if (base[i] == j) ligne = i;
+    }
+
+    if (ligne == -1) {
+        // Hors base: changement de variable sur la colonne, toutes lignes
+        for (Vecteur<T>& l : tableau) {
+            l[nbColonnes] -= delta * l[j];
+            if (inverse) l[j] = -l[j];
+        }
+        couts[j] += hausse;
+        unitesTravail += 2 * static_cast<long long>(tableau.size());
+        return;
+    }
+
+    // En base: seule sa ligne change, puis la ligne des coûts est remise
+    // à zéro sur la colonne
+    Vecteur<T>& l = tableau[ligne];
+    l[nbColonnes] -= delta;
+    if (inverse) {
+        for (int k = 0; k <= nbColonnes; k++) {
+            l[k] = -l[k];
+        }
+        l[j] = T(1);
+    }
+    if (!estZero(hausse)) {
+        for (int k = 0; k <= nbColonnes; k++) {
+            couts[k] -= hausse * l[k];
+        }
+        couts[j] = T(0);
+    }
+    unitesTravail += 2 * (nbColonnes + 1);
+}
+
+template<typename T>
+void SimplexSolverT<T>::iterationsPhase2() {
+    int iteration = 0;
+    afficherTableau(iteration++);
+
+    while (!optimumConfirme(false)) {
+        if (limiteAtteinte()) return;
+
+        int colPivot = trouverColonnePivot(false);
+        if (colPivot == -1) break;
+        orienterColonneEntrante(colPivot);
+
+        if (estNonBorne(colPivot)) {
+            etatSolution = NON_BORNE;
+            extraireRayonNonBorne(colPivot);
+            return;
+        }
+
+        avancer(colPivot, iteration);
+        controlerSante(false);
+
+        afficherTableau(iteration++);
+    }
+
+    etatSolution = OPTIMALE;
+}
+
+template<typename T>
+bool SimplexSolverT<T>::estOptimal(bool isPhase1) {
+    int nbColonnes = tableau[0].size() - 1;
 
     // ✅ Unified optimality test after transformation
     // For both Phase 1 (MIN W) and Phase 2 (MIN or transformed MAX -> MIN)
     // We check if all coefficients in objective row are non-negative
     for (int j = 0; j < nbColonnes; j++) {
-        if (tableau[nbContraintes][j] < -EPSILON) {
+        if (coutReduitEntrant(j) < -EPSILON) {
             return false;
         }
     }
     return true;
 }
 
-bool SimplexSolver::estNonBorne(int colPivot) {
+template<typename T>
+bool SimplexSolverT<T>::estNonBorne(int colPivot) {
+    if (estBornee(colPivot)) return false;
+    // Coûts par morceaux: chaque point franchi relève la pente le long de
+    // l'arête, et une variable qui décroît finit par atteindre 0
+    T hausse = T(0);
+    if (estMorceleeActive(colPivot)) {
+        if (morceauDecroissant[colPivot]) return false;
+        hausse += pentesMorceaux[colPivot].back() - pentesMorceaux[colPivot][segmentMorceau(colPivot)];
+    }
     for (int i = 0; i < nbContraintes; i++) {
-        if (tableau[i][colPivot] > EPSILON) {
-            return false;
+        if (estLibre(base[i])) continue;
+        if (estMorceleeActive(base[i])) {
+            int j = base[i];
+            T vitesse = morceauDecroissant[j] ? tableau[i][colPivot] : -tableau[i][colPivot];
+            if (vitesse < -EPSILON) return false;
+            if (vitesse > EPSILON) hausse += vitesse * (pentesMorceaux[j].back() - pentesMorceaux[j][segmentMorceau(j)]);
+            continue;
         }
+        if (tableau[i][colPivot] > EPSILON) return false;
+        // Variable de base bornée qui croît: elle finit par bloquer
+        if (tableau[i][colPivot] < -EPSILON && estBornee(base[i])) return false;
     }
-    return true;
+    if (coutsParMorceauxActifs && !(tableau[nbContraintes][colPivot] + hausse < -EPSILON)) return false;
+    // ... ou la clé d'un ensemble GUB décroît jusqu'à 0
+    T pas;
+    return trouverEnsembleBloquant(colPivot, pas) == -1;
 }
 
-int SimplexSolver::trouverColonnePivot(bool isPhase1) {
+template<typename T>
+int SimplexSolverT<T>::trouverColonnePivot(bool isPhase1) {
     int colPivot = -1;
     int nbColonnes = tableau[0].size() - 1;
 
+    // Règle de Bland: première colonne de coût réduit négatif
+    if (regleBland) {
+        for (int j = 0; j < nbColonnes; j++) {
+            if (coutReduitEntrant(j) < -EPSILON) return j;
+        }
+        return -1;
+    }
+
     // ✅ Unified pivot selection after transformation
     // For both Phase 1 and Phase 2 (after MAX->MIN conversion)
     // We look for the most negative coefficient
-    double minVal = 0.0;
+    T minVal = T(0);
     for (int j = 0; j < nbColonnes; j++) {
-        if (tableau[nbContraintes][j] < minVal - EPSILON) {
-            minVal = tableau[nbContraintes][j];
+        T d = coutReduitEntrant(j);
+        if (d < minVal - EPSILON) {
+            minVal = d;
             colPivot = j;
         }
     }
@@ -470,280 +1381,1157 @@ int SimplexSolver::trouverColonnePivot(bool isPhase1) {
     return colPivot;
 }
 
-int SimplexSolver::trouverLignePivot(int colPivot) {
+template<typename T>
+int SimplexSolverT<T>::trouverLignePivot(int colPivot, bool& versBorneSup, T& pas) {
     int lignePivot = -1;
-    double minRatio = numeric_limits<double>::max();
+    T minRatio = T(0);
+    versBorneSup = false;
 
     int nbColonnes = tableau[0].size() - 1;
+    // Pas admissible sur la ligne i: jusqu'à ce que sa variable de base
+    // atteigne 0 (a > 0) ou, si elle est bornée, sa borne (a < 0)
+    auto rapport = [&](int i, T& ratio, bool& versSup) {
+        if (base[i] < 0) return false;            // ligne redondante
+        if (estLibre(base[i])) return false;      // variable libre: jamais bloquante
+        if (estMorceleeActive(base[i])) return false;   // points de rupture: voir franchirPointsRupture
+        const T& a = tableau[i][colPivot];
+        if (a > EPSILON) {
+            // Second membre à peine négatif (arrondi): pas dégénéré
+            ratio = tableau[i][nbColonnes] / a;
+            if (ratio < T(0)) ratio = T(0);
+            versSup = false;
+            return true;
+        }
+        if (a < -EPSILON && estBornee(base[i])) {
+            ratio = (borneColonne[base[i]] - tableau[i][nbColonnes]) / -a;
+            if (ratio < T(0)) ratio = T(0);
+            versSup = true;
+            return true;
+        }
+        return false;
+    };
+
+    T ratio = T(0);
+    bool versSup = false;
     for (int i = 0; i < nbContraintes; i++) {
-        if (tableau[i][colPivot] > EPSILON) {
-            double ratio = tableau[i][nbColonnes] / tableau[i][colPivot];
-            if (ratio >= 0 && ratio < minRatio) {
-                minRatio = ratio;
+        if (rapport(i, ratio, versSup) && (lignePivot == -1 || ratio < minRatio)) {
+            minRatio = ratio;
+            lignePivot = i;
+            versBorneSup = versSup;
+        }
+    }
+
+    // Règle de Bland: parmi les rapports minimaux (à EPSILON près), la
+    // variable sortante de plus petit indice
+    if (regleBland && lignePivot != -1) {
+        for (int i = 0; i < nbContraintes; i++) {
+            if (!rapport(i, ratio, versSup)) continue;
+            if (!(ratio > minRatio + EPSILON) && base[i] < base[lignePivot]) {
                 lignePivot = i;
+                versBorneSup = versSup;
             }
         }
     }
 
+    // Colonne entrante bornée: sa propre borne peut arriver avant
+    if (estBornee(colPivot) && (lignePivot == -1 || borneColonne[colPivot] < minRatio)) {
+        pas = borneColonne[colPivot];
+        return CHANGEMENT_BORNE;
+    }
+    pas = minRatio;
     return lignePivot;
 }
 
-void SimplexSolver::pivoter(int lignePivot, int colPivot) {
-    double pivot = tableau[lignePivot][colPivot];
+template<typename T>
+T SimplexSolverT<T>::valeurCle(int ensemble) const {
+    int nbColonnes = tableau[0].size() - 1;
+    T valeur = secondMembreGub[ensemble];
+    for (int i = 0; i < nbContraintes; i++) {
+        if (base[i] >= 0 && ensembleColonne[base[i]] == ensemble) valeur -= tableau[i][nbColonnes];
+    }
+    return valeur;
+}
+
+template<typename T>
+int SimplexSolverT<T>::trouverEnsembleBloquant(int colPivot, T& pas) {
+    int nbEnsembles = secondMembreGub.size();
+    if (nbEnsembles == 0) return -1;
+
+    // Quand la colonne entrante croît de t, la clé de l'ensemble k varie
+    // de -t * (1 si elle en est membre, moins la somme de ses
+    // coefficients sur les lignes dont la variable de base est membre)
+    int nbColonnes = tableau[0].size() - 1;
+    for (int k = 0; k < nbEnsembles; k++) {
+        tauxCleGub[k] = T(0);
+        valeurCleGub[k] = secondMembreGub[k];
+    }
+    if (ensembleColonne[colPivot] != -1) tauxCleGub[ensembleColonne[colPivot]] = T(1);
+    for (int i = 0; i < nbContraintes; i++) {
+        if (base[i] < 0) continue;
+        int k = ensembleColonne[base[i]];
+        if (k == -1) continue;
+        tauxCleGub[k] -= tableau[i][colPivot];
+        valeurCleGub[k] -= tableau[i][nbColonnes];
+    }
+
+    int ensemble = -1;
+    for (int k = 0; k < nbEnsembles; k++) {
+        if (!(tauxCleGub[k] > EPSILON)) continue;
+        T ratio = valeurCleGub[k] / tauxCleGub[k];
+        if (ratio < T(0)) ratio = T(0);
+        if (ensemble == -1 || ratio < pas) {
+            ensemble = k;
+            pas = ratio;
+        }
+    }
+    return ensemble;
+}
+
+template<typename T>
+void SimplexSolverT<T>::changerCle(int ensemble, int colonne) {
+    // La colonne devient la clé de l'ensemble: chaque autre membre j prend
+    // la colonne a_j - a_cle (l'ancienne clé, nulle, prend -a_cle) et le
+    // second membre perd b_k * a_cle, sur toutes les lignes y compris
+    // celles des coûts. Une clé en base libère sa ligne.
+    int nbColonnes = tableau[0].size() - 1;
+    for (Vecteur<T>& ligne : tableau) {
+        T f = ligne[colonne];
+        ligne[colonne] = T(0);
+        if (estZero(f)) continue;
+        for (int j = 0; j < nbColonnes; j++) {
+            if (ensembleColonne[j] == ensemble && j != colonne) ligne[j] -= f;
+        }
+        ligne[nbColonnes] -= f * secondMembreGub[ensemble];
+        unitesTravail += nbColonnes + 1;
+    }
+    cleGub[ensemble] = colonne;
+}
+
+template<typename T>
+void SimplexSolverT<T>::remplacerCle(int ensemble, int colPivot, int iteration, bool pasNul) {
+    // La clé atteint 0 en premier. Le membre de l'ensemble de plus grande
+    // valeur en base prend sa place et la colonne entrante sa ligne; sans
+    // membre en base, la colonne entrante devient elle-même la clé.
+    int nbColonnes = tableau[0].size() - 1;
+    int ligne = -1;
+    for (int i = 0; i < nbContraintes; i++) {
+        if (base[i] < 0 || ensembleColonne[base[i]] != ensemble) continue;
+        if (ligne == -1 || tableau[ligne][nbColonnes] < tableau[i][nbColonnes]) ligne = i;
+    }
+
+    journal() << "\nIteration " << iteration << ": Variable entrante = "
+         << nomsVariables[colPivot] << ", Variable sortante = "
+         << nomsVariables[cleGub[ensemble]] << " (cle GUB, remplacee par "
+         << nomsVariables[ligne == -1 ? colPivot : base[ligne]] << ")" << endl;
+
+    suivreStagnation(pasNul);
+    if (ligne == -1) {
+        changerCle(ensemble, colPivot);
+    } else {
+        // Les autres membres en base ont maintenant la colonne e_i - e_ligne:
+        // leurs lignes ajoutées à la ligne libérée rétablissent les colonnes
+        // unité. Le pivot vaut alors moins le taux de décroissance de la clé.
+        changerCle(ensemble, base[ligne]);
+        for (int i = 0; i < nbContraintes; i++) {
+            if (i == ligne || base[i] < 0 || ensembleColonne[base[i]] != ensemble) continue;
+            for (int j = 0; j <= nbColonnes; j++) {
+                tableau[ligne][j] += tableau[i][j];
+            }
+            unitesTravail += nbColonnes + 1;
+        }
+        pivoter(ligne, colPivot);
+        base[ligne] = colPivot;
+    }
+
+    // Égalités au test du rapport: pas de second membre à peine négatif
+    for (int i = 0; i < nbContraintes; i++) {
+        if (!estLibre(base[i]) && tableau[i][nbColonnes] < T(0) && estZero(tableau[i][nbColonnes])) {
+            tableau[i][nbColonnes] = T(0);
+        }
+    }
+    nbIterations++;
+}
+
+template<typename T>
+void SimplexSolverT<T>::ajouterPointsFranchis(int j, int ligne, T x0, T vitesse, bool& dur, T& pasDur,
+                                              int& colonneDure, int& ligneDure) {
+    // x_j part de x0 et varie de vitesse par unité de pas: points de
+    // rupture rencontrés, jusqu'au blocage le plus proche; 0 bloque
+    const Vecteur<T>& points = pointsRupture[j];
+    const Vecteur<T>& pentes = pentesMorceaux[j];
+    int segment = segmentMorceau(j);
+    int dernier = static_cast<int>(points.size()) - 1;
+
+    if (vitesse > EPSILON) {
+        for (int k = segment + 1; k <= dernier; k++) {
+            T pas = (points[k] - x0) / vitesse;
+            if (pas < T(0)) pas = T(0);
+            if (dur && !(pas < pasDur)) return;
+            pointsFranchis.push_back({pas, vitesse * (pentes[k] - pentes[k - 1]), j, ligne, k, false});
+        }
+    } else if (vitesse < -EPSILON) {
+        for (int k = segment; k >= 0; k--) {
+            T pas = (x0 - points[k]) / -vitesse;
+            if (pas < T(0)) pas = T(0);
+            if (dur && !(pas < pasDur)) return;
+            if (k == 0) {
+                dur = true;
+                pasDur = pas;
+                colonneDure = j;
+                ligneDure = ligne;
+                return;
+            }
+            pointsFranchis.push_back({pas, -vitesse * (pentes[k] - pentes[k - 1]), j, ligne, k, true});
+        }
+    }
+}
+
+template<typename T>
+bool SimplexSolverT<T>::franchirPointsRupture(int colPivot, int iteration, bool dur, T pasDur) {
+    // Pas long: la pente de l'objectif le long de l'arête part de d < 0
+    // et augmente à chaque point de rupture franchi (|vitesse| * saut de
+    // pente). On avance jusqu'au point où elle devient >= 0, ou jusqu'au
+    // blocage ordinaire; les variables passées sont réancrées au passage.
+    // Rend false si ce blocage ordinaire reste à exécuter par l'appelant.
+    int nbColonnes = tableau[0].size() - 1;
+    pointsFranchis.clear();
+    int colonneDure = -1, ligneDure = -1;
+
+    if (estMorcelee(colPivot)) {
+        T vitesse = morceauDecroissant[colPivot] ? T(-1) : T(1);
+        ajouterPointsFranchis(colPivot, -1, pointsRupture[colPivot][ancreMorceau[colPivot]], vitesse,
+                              dur, pasDur, colonneDure, ligneDure);
+    }
+    for (int i = 0; i < nbContraintes; i++) {
+        int j = base[i];
+        if (!estMorcelee(j)) continue;
+        const T& a = tableau[i][colPivot];
+        const T& v = tableau[i][nbColonnes];
+        const T& point = pointsRupture[j][ancreMorceau[j]];
+        if (morceauDecroissant[j]) {
+            ajouterPointsFranchis(j, i, point - v, a, dur, pasDur, colonneDure, ligneDure);
+        } else {
+            ajouterPointsFranchis(j, i, point + v, -a, dur, pasDur, colonneDure, ligneDure);
+        }
+    }
+    if (pointsFranchis.empty() && colonneDure == -1) return false;
+
+    sort(pointsFranchis.begin(), pointsFranchis.end(),
+         [](const PointFranchi& a, const PointFranchi& b) { return a.pas < b.pas; });
+
+    T pente = tableau[nbContraintes][colPivot];
+    int arret = -1;
+    int nbFranchis = 0;
+    for (const PointFranchi& p : pointsFranchis) {
+        if (dur && !(p.pas < pasDur)) break;
+        pente += p.hausse;
+        if (!(pente < -EPSILON)) {
+            arret = nbFranchis;
+            break;
+        }
+        nbFranchis++;
+    }
+
+    for (int k = 0; k < nbFranchis; k++) {
+        const PointFranchi& p = pointsFranchis[k];
+        reancrerMorceau(p.colonne, p.point, p.decroissant);
+    }
+    if (nbFranchis > 0) {
+        journal() << "\nPas long: " << nbFranchis << " point(s) de rupture franchi(s)";
+    }
+
+    // Arrêt sur un point de rupture, ou sur 0 pour une variable à coût par
+    // morceaux: elle y est réancrée puis sort de la base (ou, si c'est la
+    // colonne entrante, y reste sans pivot)
+    int colonne = -1, ligne = -1;
+    T pas = pasDur;
+    if (arret != -1) {
+        const PointFranchi& p = pointsFranchis[arret];
+        reancrerMorceau(p.colonne, p.point, p.decroissant);
+        colonne = p.colonne;
+        ligne = p.ligne;
+        pas = p.pas;
+    } else if (colonneDure != -1) {
+        reancrerMorceau(colonneDure, 0, false);
+        colonne = colonneDure;
+        ligne = ligneDure;
+    } else {
+        return false;
+    }
+
+    journal() << "\nIteration " << iteration << ": Variable entrante = " << nomsVariables[colPivot];
+    if (ligne == -1) {
+        journal() << ", arret au point " << pointsRupture[colonne][ancreMorceau[colonne]]
+             << " (pas de pivot)" << endl;
+    } else {
+        journal() << ", Variable sortante = " << nomsVariables[colonne]
+             << " (au point " << pointsRupture[colonne][ancreMorceau[colonne]] << ")" << endl;
+        pivoter(ligne, colPivot);
+        base[ligne] = colPivot;
+    }
+    suivreStagnation(!estZero(pas));
+    nbIterations++;
+    return true;
+}
+
+template<typename T>
+void SimplexSolverT<T>::avancer(int colPivot, int iteration) {
+    bool versBorneSup = false;
+    T pas = T(0);
+    int lignePivot = trouverLignePivot(colPivot, versBorneSup, pas);
+
+    // Clé d'un ensemble GUB à 0 strictement avant la ligne sortante
+    T pasCle = T(0);
+    int ensemble = trouverEnsembleBloquant(colPivot, pasCle);
+    bool cle = ensemble != -1 && (lignePivot == -1 || pasCle < pas);
+    if (cle) pas = pasCle;
+
+    // Pas long: les points de rupture franchis avant ce blocage
+    if (nbVariablesMorcelees > 0 && coutsParMorceauxActifs &&
+        franchirPointsRupture(colPivot, iteration, lignePivot != -1 || cle, pas)) {
+        return;
+    }
+
+    if (cle) {
+        remplacerCle(ensemble, colPivot, iteration, !estZero(pasCle));
+        return;
+    }
+
+    if (lignePivot == CHANGEMENT_BORNE) {
+        journal() << "\nIteration " << iteration << ": " << nomsVariables[colPivot]
+             << " atteint sa borne " << borneColonne[colPivot] << " avant toute variable de base"
+             << " (changement de borne, pas de pivot)" << endl;
+        changerBorne(colPivot);
+        suivreStagnation(true);
+        nbIterations++;
+        return;
+    }
+
+    journal() << "\nIteration " << iteration << ": Variable entrante = "
+         << nomsVariables[colPivot] << ", Variable sortante = "
+         << nomsVariables[base[lignePivot]];
+    if (versBorneSup) {
+        journal() << " (a sa borne " << borneColonne[base[lignePivot]] << ")";
+        substituerBorneSortante(lignePivot);
+    }
+    journal() << endl;
+
+    int nbColonnes = tableau[0].size() - 1;
+    bool pasNul = !estZero(tableau[lignePivot][nbColonnes]);
+    if (!pasNul) tableau[lignePivot][nbColonnes] = T(0);   // voir sortirArtificiellesDeLaBase
+    suivreStagnation(pasNul);
+    pivoter(lignePivot, colPivot);
+    base[lignePivot] = colPivot;
+    nbIterations++;
+}
+
+template<typename T>
+void SimplexSolverT<T>::suivreStagnation(bool pasNul) {
+    if (pasNul) {
+        // Pas non nul: l'objectif progresse, le cyclage est rompu
+        nbPivotsDegeneresConsecutifs = 0;
+        if (regleBland) {
+            journal() << "Pivot non degenere: retour a la regle de Dantzig\n";
+            regleBland = false;
+        }
+        return;
+    }
+
+    nbPivotsDegeneres++;
+    nbPivotsDegeneresConsecutifs++;
+    if (!regleBland && nbPivotsDegeneresConsecutifs >= SEUIL_STAGNATION) {
+        journal() << "\n*** Stagnation: " << nbPivotsDegeneresConsecutifs
+             << " pivots degeneres consecutifs, passage a la regle de Bland ***\n";
+        regleBland = true;
+    }
+}
+
+template<typename T>
+void SimplexSolverT<T>::pivoter(int lignePivot, int colPivot) {
+    T pivot = tableau[lignePivot][colPivot];
     int nbColonnes = tableau[0].size();
 
 
-    if (abs(pivot) < EPSILON) {
+    if (estZero(pivot)) {
         throw runtime_error("ERREUR: Element pivot est proche de zero!");
     }
+    if (!reinversionEnCours) mesurerPivot(lignePivot, colPivot);
 
     for (int j = 0; j < nbColonnes; j++) {
         tableau[lignePivot][j] /= pivot;
     }
 
-    for (int i = 0; i <= nbContraintes; i++) {
+    unitesTravail += nbColonnes;
+    // Toutes les lignes, y compris la ligne des coûts du mode composite
+    for (int i = 0; i < static_cast<int>(tableau.size()); i++) {
         if (i != lignePivot && !estZero(tableau[i][colPivot])) {
-            double facteur = tableau[i][colPivot];
+            T facteur = tableau[i][colPivot];
             for (int j = 0; j < nbColonnes; j++) {
                 tableau[i][j] -= facteur * tableau[lignePivot][j];
             }
+            unitesTravail += nbColonnes;
+        }
+    }
+}
+
+template<typename T>
+void SimplexSolverT<T>::mesurerPivot(int lignePivot, int colPivot) {
+    // |pivot| rapporté au plus grand coefficient de sa colonne: un pivot
+    // relatif faible amplifie les erreurs de toute la ligne pivot
+    T maxColonne = T(0);
+    for (int i = 0; i < nbContraintes; i++) {
+        T val = TraitsScalaire<T>::abs(tableau[i][colPivot]);
+        if (maxColonne < val) maxColonne = val;
+    }
+    T pivot = TraitsScalaire<T>::abs(tableau[lignePivot][colPivot]);
+    double absolu = TraitsScalaire<T>::versDouble(pivot);
+    double relatif = TraitsScalaire<T>::versDouble(pivot / maxColonne);
+
+    if (sante.nbPivots == 0) {
+        sante.pivotMin = sante.pivotMax = absolu;
+        sante.pivotRelatifMin = relatif;
+    } else {
+        sante.pivotMin = min(sante.pivotMin, absolu);
+        sante.pivotMax = max(sante.pivotMax, absolu);
+        sante.pivotRelatifMin = min(sante.pivotRelatifMin, relatif);
+    }
+    sante.nbPivots++;
+    if (relatif < SEUIL_PIVOT_FAIBLE) {
+        sante.nbPivotsFaibles++;
+        controleAnticipe = true;
+    }
+}
+
+template<typename T>
+void SimplexSolverT<T>::debuterResolution() {
+    debutResolution = chrono::steady_clock::now();
+    nbIterations = 0;
+    unitesTravail = 0;
+    nbPivotsDegeneres = 0;
+    nbPivotsCrash = 0;
+    interrompu = false;
+    causeArret = ARRET_AUCUN;
+    etatSolution = EN_COURS;
+    solutionRealisable = false;
+    valeurObjectif = T(0);
+    solutionOptimale.clear();
+    rayonFarkas.clear();
+    rayonNonBorne.clear();
+    sante = SanteNumerique();
+    iterationsDepuisControle = 0;
+    controleAnticipe = false;
+}
+
+template<typename T>
+bool SimplexSolverT<T>::baseReprenable() const {
+    if (tableau.empty() || phaseRealisabilite || !solutionRealisable) return false;
+    if (etatSolution != OPTIMALE && etatSolution != NON_BORNE) return false;
+    if (static_cast<int>(tableau.size()) != nbContraintes + 1) return false;
+    for (int i = 0; i < nbContraintes; i++) {
+        if (base[i] < 0) return false;
+    }
+    return true;
+}
+
+template<typename T>
+bool SimplexSolverT<T>::optimumConfirme(bool isPhase1) {
+    if (!estOptimal(isPhase1)) return false;
+    return !controlerSante(true) || estOptimal(isPhase1);
+}
+
+template<typename T>
+bool SimplexSolverT<T>::controlerSante(bool final) {
+    // Arithmétique exacte (EPSILON nul): rien ne dérive. Mode GUB: lignes
+    // et colonnes transformées, pas de modèle d'origine à reconstruire
+    if (periodeControle <= 0 || !(T(0) < EPSILON) || !secondMembreGub.empty()) return false;
+    if (!final && ++iterationsDepuisControle < periodeControle && !controleAnticipe) return false;
+    iterationsDepuisControle = 0;
+    controleAnticipe = false;
+
+    double derive = mesurerSante(final);
+    if (!(TraitsScalaire<T>::seuilDerive() < derive)) return false;
+
+    if (!reinverser()) {
+        journal() << "\nDerive numerique " << scientific << setprecision(2) << derive << defaultfloat
+             << ": base singuliere a la tolerance, tableau conserve\n";
+        return false;
+    }
+    sante.nbReinversions++;
+    journal() << "\nDerive numerique " << scientific << setprecision(2) << derive << defaultfloat
+             << ": tableau reconstruit depuis le modele pour la base courante\n";
+    mesurerSante(final);
+    return true;
+}
+
+template<typename T>
+T SimplexSolverT<T>::ecartCouts(int ligne, bool phase1, T& echelle) {
+    int nbColonnes = tableau[0].size() - 1;
+    auto coutColonne = [&](int j) {
+        if (phase1) return colonneArtificielle[j] ? T(1) : T(0);
+        return coutTransforme(j);
+    };
+
+    // d = c - sum_i c_B(i) alpha_i; l'échelle suit les termes sommés
+    T normeCouts = T(0);
+    T normeTermes = T(0);
+    coutsControle.resize(nbColonnes);
+    for (int j = 0; j < nbColonnes; j++) {
+        coutsControle[j] = coutColonne(j);
+        T val = TraitsScalaire<T>::abs(coutsControle[j]);
+        if (normeCouts < val) normeCouts = val;
+    }
+    for (int i = 0; i < nbContraintes; i++) {
+        if (base[i] < 0) continue;
+        T coefBase = coutColonne(base[i]);
+        if (coefBase == T(0)) continue;
+        T somme = T(0);
+        for (int j = 0; j < nbColonnes; j++) {
+            T terme = coefBase * tableau[i][j];
+            coutsControle[j] -= terme;
+            somme += TraitsScalaire<T>::abs(terme);
         }
+        if (normeTermes < somme) normeTermes = somme;
     }
+
+    T ecart = T(0);
+    for (int j = 0; j < nbColonnes; j++) {
+        T val = TraitsScalaire<T>::abs(tableau[ligne][j] - coutsControle[j]);
+        if (ecart < val) ecart = val;
+    }
+    echelle = T(1) + normeCouts + normeTermes;
+    return ecart / echelle;
 }
 
-void SimplexSolver::extraireSolution() {
+template<typename T>
+double SimplexSolverT<T>::mesurerSante(bool final) {
+    int nbColonnes = tableau[0].size() - 1;
+    sante.nbControles++;
+
+    // Variables de base dans leurs bornes, à EPSILON près à l'échelle de b
+    T normeB = T(0);
+    for (int i = 0; i < nbContraintes; i++) {
+        T val = TraitsScalaire<T>::abs(Bi[i]);
+        if (normeB < val) normeB = val;
+    }
+    T echelleB = T(1) + normeB;
+    T horsBornes = T(0);
+    valeursControle.assign(nbColonnes, T(0));
+    for (int i = 0; i < nbContraintes; i++) {
+        int j = base[i];
+        if (j < 0) continue;
+        T v = tableau[i][nbColonnes];
+        valeursControle[j] = v;
+        T depassement = T(0);
+        if (!estLibre(j) && v < T(0)) depassement = -v;
+        else if (estBornee(j) && borneColonne[j] < v) depassement = v - borneColonne[j];
+        if (EPSILON * echelleB < depassement) sante.nbViolationsTolerance++;
+        if (horsBornes < depassement) horsBornes = depassement;
+    }
+
+    // Résidu primal au point courant: x = u - x' pour une colonne à sa
+    // borne, x = p_r + v ou p_r - v pour un coût par morceaux
+    for (int j = 0; j < nbColonnes; j++) {
+        T& x = valeursControle[j];
+        if (colonneAuMax[j]) {
+            x = borneColonne[j] - x;
+        } else if (estMorcelee(j)) {
+            const T& p = pointsRupture[j][ancreMorceau[j]];
+            x = morceauDecroissant[j] ? p - x : p + x;
+        }
+    }
+    residusControle.assign(nbContraintes, T(0));
+    for (int j = nbVariablesDecision; j < nbColonnes; j++) {
+        int i = ligneColonne[j];
+        if (i >= 0) residusControle[i] += coefficientEcart(j) * valeursControle[j];
+    }
+    T residu = T(0);
+    T echelleResidu = echelleB;
+    for (int i = 0; i < nbContraintes; i++) {
+        T r = Bi[i] - residusControle[i];
+        T somme = TraitsScalaire<T>::abs(Bi[i]) + TraitsScalaire<T>::abs(residusControle[i]);
+        for (int j = 0; j < nbVariablesDecision; j++) {
+            if (valeursControle[j] == T(0)) continue;
+            T terme = matriceContraintes[i][j] * valeursControle[j];
+            r -= terme;
+            somme += TraitsScalaire<T>::abs(terme);
+        }
+        T val = TraitsScalaire<T>::abs(r);
+        if (residu < val) residu = val;
+        if (echelleResidu < T(1) + somme) echelleResidu = T(1) + somme;
+    }
+    residu /= echelleResidu;
+
+    // Coûts réduits: ceux du tableau contre c - c_B B^-1 A, pour chaque
+    // ligne de coûts en place
+    T echelleCouts = T(1);
+    T ecart = ecartCouts(nbContraintes, phaseRealisabilite, echelleCouts);
+    if (final) {
+        // Fin de phase: coûts réduits du mauvais signe, recalculés
+        T infaisabilite = T(0);
+        for (int j = 0; j < nbColonnes; j++) {
+            if (estMorceleeActive(j)) continue;
+            T d = coutsControle[j];
+            T violation = estLibre(j) ? TraitsScalaire<T>::abs(d) : -d;
+            if (EPSILON * echelleCouts < violation) sante.nbViolationsTolerance++;
+            if (infaisabilite < violation) infaisabilite = violation;
+        }
+        sante.infaisabiliteDuale = TraitsScalaire<T>::versDouble(infaisabilite / echelleCouts);
+        sante.infaisabilitePrimale = TraitsScalaire<T>::versDouble(horsBornes / echelleB);
+    }
+    if (phaseRealisabilite && static_cast<int>(tableau.size()) > nbContraintes + 1) {
+        T echelleZ = T(1);
+        T ecartZ = ecartCouts(nbContraintes + 1, false, echelleZ);
+        if (ecart < ecartZ) ecart = ecartZ;
+    }
+
+    // kappa_1(B) ~ ||B||_1 max_j ||B^-1 a_j||_1 / ||a_j||_1
+    coutsControle.assign(nbColonnes, T(0));
+    for (int i = 0; i < nbContraintes; i++) {
+        for (int j = 0; j < nbColonnes; j++) {
+            coutsControle[j] += TraitsScalaire<T>::abs(tableau[i][j]);
+        }
+    }
+    T normeBase = T(0);
+    for (int i = 0; i < nbContraintes; i++) {
+        if (base[i] >= 0 && normeBase < normeColonne[base[i]]) normeBase = normeColonne[base[i]];
+    }
+    T normeInverse = T(0);
+    for (int j = 0; j < nbColonnes; j++) {
+        if (!(T(0) < normeColonne[j])) continue;
+        T val = coutsControle[j] / normeColonne[j];
+        if (normeInverse < val) normeInverse = val;
+    }
+
+    double residuD = TraitsScalaire<T>::versDouble(residu);
+    double ecartD = TraitsScalaire<T>::versDouble(ecart);
+    sante.conditionnementFinal = TraitsScalaire<T>::versDouble(normeBase * normeInverse);
+    sante.residuPrimalMax = max(sante.residuPrimalMax, residuD);
+    sante.ecartCoutsMax = max(sante.ecartCoutsMax, ecartD);
+    sante.conditionnementMax = max(sante.conditionnementMax, sante.conditionnementFinal);
+    return max(residuD, ecartD);
+}
+
+template<typename T>
+bool SimplexSolverT<T>::reinverser() {
+    // Nouveau tableau construit à côté de l'ancien, rendu intact si la
+    // base se révèle singulière
+    int nbColonnes = tableau[0].size() - 1;
+    int nbLignes = tableau.size();
+    baseReinversion.assign(base.begin(), base.end());
+    tableau.swap(tableauReinversion);
+    tableau.resize(nbLignes);
+    for (Vecteur<T>& ligne : tableau) {
+        ligne.assign(nbColonnes + 1, T(0));
+    }
+
+    for (int i = 0; i < nbContraintes; i++) {
+        for (int j = 0; j < nbVariablesDecision; j++) {
+            tableau[i][j] = matriceContraintes[i][j];
+        }
+        tableau[i][nbColonnes] = Bi[i];
+    }
+    for (int j = nbVariablesDecision; j < nbColonnes; j++) {
+        if (ligneColonne[j] >= 0) tableau[ligneColonne[j]][j] = coefficientEcart(j);
+    }
+    // Changements de variable en cours: x = u - x' (colonne à sa borne),
+    // x = p_r + v ou p_r - v (coût par morceaux)
+    for (int j = 0; j < nbColonnes; j++) {
+        T origine = T(0);
+        bool inverse = false;
+        if (colonneAuMax[j]) {
+            origine = borneColonne[j];
+            inverse = true;
+        } else if (estMorcelee(j)) {
+            origine = pointsRupture[j][ancreMorceau[j]];
+            inverse = morceauDecroissant[j];
+        }
+        if (!inverse && origine == T(0)) continue;
+        for (int i = 0; i < nbContraintes; i++) {
+            T& a = tableau[i][j];
+            tableau[i][nbColonnes] -= origine * a;
+            if (inverse) a = -a;
+        }
+    }
+    unitesTravail += static_cast<long long>(nbLignes) * (nbColonnes + 1);
+
+    // Gauss-Jordan sur les colonnes de la base, pivot partiel: une colonne
+    // peut changer de ligne
+    reinversionEnCours = true;
+    base.assign(nbContraintes, -1);
+    bool singuliere = false;
+    for (int k = 0; k < nbContraintes && !singuliere; k++) {
+        int colonne = baseReinversion[k];
+        if (colonne < 0) continue;
+
+        int lignePivot = -1;
+        T maxVal = T(0);
+        for (int i = 0; i < nbContraintes; i++) {
+            if (base[i] != -1) continue;
+            T val = TraitsScalaire<T>::abs(tableau[i][colonne]);
+            if (val > EPSILON && (lignePivot == -1 || val > maxVal)) {
+                maxVal = val;
+                lignePivot = i;
+            }
+        }
+        if (lignePivot == -1) {
+            singuliere = true;
+        } else {
+            pivoter(lignePivot, colonne);
+            base[lignePivot] = colonne;
+        }
+    }
+    reinversionEnCours = false;
+
+    if (singuliere) {
+        tableau.swap(tableauReinversion);
+        base.assign(baseReinversion.begin(), baseReinversion.end());
+        return false;
+    }
+
+    for (int i = 0; i < nbContraintes; i++) {
+        if (base[i] >= 0 && !estLibre(base[i]) && tableau[i][nbColonnes] < T(0) && estZero(tableau[i][nbColonnes])) {
+            tableau[i][nbColonnes] = T(0);
+        }
+    }
+
+    // Lignes de coûts recalculées sur la nouvelle base
+    if (phaseRealisabilite) {
+        initialiserObjectifPhase1(colonneArtificielle);
+        if (nbLignes > nbContraintes + 1) calculerLigneCouts(nbContraintes + 1);
+    } else {
+        calculerLigneCouts(nbContraintes);
+    }
+    return true;
+}
+
+template<typename T>
+void SimplexSolverT<T>::extraireSolution() {
     int nbColonnes = tableau[0].size() - 1;
 
     // Get objective value
-    double tableauValue = tableau[nbContraintes][nbColonnes];
+    T tableauValue = tableau[nbContraintes][nbColonnes];
 
-    // ✅ Correct extraction for both MAX and MIN
+    // The RHS of the objective row holds -(minimized objective):
+    // MIN Z -> -Z, MIN (-Z) for MAX -> Z
     if (typeObj == MAX) {
-        valeurObjectif = -tableauValue;  // Because we solved MIN (-Z)
+        valeurObjectif = tableauValue;
     } else {
-        valeurObjectif = tableauValue;   // Because we solved MIN Z
+        valeurObjectif = -tableauValue;
     }
 
     // Temporary solution for transformed variables
-    vector<double> transformedSolution(nbVariablesDecision, 0.0);
+    Vecteur<T> transformedSolution(nbVariablesDecision, T(0), &temporaires);
 
     for (int i = 0; i < nbContraintes; i++) {
-        if (base[i] < nbVariablesDecision) {
+        if (base[i] >= 0 && base[i] < nbVariablesDecision) {
             transformedSolution[base[i]] = tableau[i][nbColonnes];
         }
     }
+    for (int k = 0; k < static_cast<int>(cleGub.size()); k++) {
+        if (cleGub[k] < nbVariablesDecision) transformedSolution[cleGub[k]] = valeurCle(k);
+    }
+    // Coût par morceaux: x_j = p_r + v ou p_r - v
+    for (int j = 0; j < nbVariablesDecision; j++) {
+        if (!estMorcelee(j)) continue;
+        const T& point = pointsRupture[j][ancreMorceau[j]];
+        T& x = transformedSolution[j];
+        x = morceauDecroissant[j] ? point - x : point + x;
+    }
+
+    convertirSolutionTransformee(transformedSolution);
+    solutionRealisable = true;
+}
 
+template<typename T>
+void SimplexSolverT<T>::convertirSolutionTransformee(const Vecteur<T>& transformedSolution) {
     // Map back to original variables
     solutionOptimale.resize(nbVariablesOriginales);
 
-    int transformedIndex = 0;
     for (int j = 0; j < nbVariablesOriginales; j++) {
-        if (typesVariables[j] == NON_NEGATIVE) {
-            solutionOptimale[j] = transformedSolution[transformedIndex];
-            transformedIndex++;
-        } else if (typesVariables[j] == NON_POSITIVE) {
-            solutionOptimale[j] = -transformedSolution[transformedIndex];
-            transformedIndex++;
-        } else { // UNRESTRICTED
-            double xPrime = transformedSolution[transformedIndex];
-            double xDoublePrime = transformedSolution[transformedIndex + 1];
-            solutionOptimale[j] = xPrime - xDoublePrime;
-            transformedIndex += 2;
+        solutionOptimale[j] = colonneInversee[j] ? -transformedSolution[j] : transformedSolution[j];
+    }
+}
+
+template<typename T>
+void SimplexSolverT<T>::extraireRayonFarkas() {
+    // Multiplicateurs pi de la phase 1 lus sur la ligne W, à la colonne
+    // identité de chaque ligne (écart d'une ligne LEQ, artificielle
+    // sinon): d = c - pi_i. y = -pi est une solution du dual de la phase
+    // 1 sans son terme en c des artificielles: y >= 0 (LEQ), <= 0 (GEQ),
+    // y.a_j >= 0 (= 0 pour une colonne libre) et y.b = -W < 0. Une
+    // colonne à sa borne (écart RANGE) porte -d; le terme de sa borne est
+    // le second membre de l'autre extrémité de l'intervalle.
+    rayonFarkas.clear();
+    if (tableau.empty() || !secondMembreGub.empty()) return;
+
+    const Vecteur<T>& ligneW = tableau[nbContraintes];
+    Vecteur<T> y(nbContraintes, T(0), &temporaires);
+    int colonne = nbVariablesDecision;
+    for (int i = 0; i < nbContraintes; i++) {
+        if (typesContraintes[i] == GEQ) colonne++;   // excédent
+        T d = colonneAuMax[colonne] ? -ligneW[colonne] : ligneW[colonne];
+        T v = (typesContraintes[i] == LEQ) ? d : d - T(1);
+        if (!estZero(v)) y[i] = v;
+        colonne++;
+    }
+
+    // Vérification sur le modèle transformé (lignes de second membre
+    // >= 0, colonnes >= 0 sauf libres)
+    T somme = T(0), echelle = T(0);
+    for (int i = 0; i < nbContraintes; i++) {
+        const T& v = y[i];
+        if (v == T(0)) continue;
+        if (!ligneIntervalle[i] && ((typesContraintes[i] == LEQ && v < T(0)) ||
+                                    (typesContraintes[i] == GEQ && T(0) < v))) return;
+        T b = Bi[i];
+        if (ligneIntervalle[i]) {
+            if (typesContraintes[i] == LEQ && v < T(0)) b -= etendueLigne[i];
+            if (typesContraintes[i] == GEQ && T(0) < v) b += etendueLigne[i];
+        }
+        somme += v * b;
+        echelle += TraitsScalaire<T>::abs(v * b);
+    }
+    if (!(somme < -EPSILON * (T(1) + echelle))) return;
+
+    for (int j = 0; j < nbVariablesDecision; j++) {
+        T produit = T(0), echelleColonne = T(0);
+        for (int i = 0; i < nbContraintes; i++) {
+            if (y[i] == T(0) || matriceContraintes[i][j] == T(0)) continue;
+            T terme = y[i] * matriceContraintes[i][j];
+            produit += terme;
+            echelleColonne += TraitsScalaire<T>::abs(terme);
         }
+        T tolerance = EPSILON * (T(1) + echelleColonne);
+        if (produit < -tolerance) return;
+        if (variableLibre[j] && tolerance < produit) return;
+    }
+
+    // Retour au signe des lignes saisies
+    rayonFarkas.resize(nbContraintes);
+    for (int i = 0; i < nbContraintes; i++) {
+        rayonFarkas[i] = lignesInversees[i] ? -y[i] : y[i];
     }
 }
 
-void SimplexSolver::afficherFormeStandard() const {
-    cout << "\n--- FORME STANDARD (apres transformation) ---\n\n";
+template<typename T>
+void SimplexSolverT<T>::extraireRayonNonBorne(int colPivot) {
+    // La colonne entrante croît de t, chaque variable de base varie de
+    // -alpha_i t: r = (1 sur la colonne, -alpha sur les variables de
+    // base), restreint aux variables de décision. estNonBorne garantit
+    // alpha <= 0 pour toute variable de base non libre, et c.r vaut le
+    // coût réduit de la colonne, < 0 dans le sens MIN du tableau.
+    rayonNonBorne.clear();
+    if (!secondMembreGub.empty() || nbVariablesMorcelees > 0) return;
+
+    Vecteur<T> r(nbVariablesDecision, T(0), &temporaires);
+    if (colPivot < nbVariablesDecision) r[colPivot] = T(1);
+    for (int i = 0; i < nbContraintes; i++) {
+        if (base[i] < 0 || base[i] >= nbVariablesDecision) continue;
+        const T& a = tableau[i][colPivot];
+        if (!estZero(a)) r[base[i]] = -a;
+    }
 
-    cout << (typeObj == MAX ? "Max" : "Min") << " Z = ";
-    for (int i = 0; i < nbVariablesDecision; i++) {
-        if (i > 0 && fonctionObjectif[i] >= 0) cout << " + ";
-        else if (i > 0) cout << " ";
+    // Vérification sur le modèle transformé
+    T coutRayon = T(0), echelle = T(0);
+    for (int j = 0; j < nbVariablesDecision; j++) {
+        if (r[j] == T(0)) continue;
+        if (!variableLibre[j] && r[j] < T(0)) return;
+        T terme = coutPhase2(j) * r[j];
+        coutRayon += terme;
+        echelle += TraitsScalaire<T>::abs(terme);
+    }
+    if (!(coutRayon < -EPSILON * (T(1) + echelle))) return;
 
-        cout << fonctionObjectif[i] << "*";
+    for (int i = 0; i < nbContraintes; i++) {
+        T produit = T(0), echelleLigne = T(0);
+        for (int j = 0; j < nbVariablesDecision; j++) {
+            if (r[j] == T(0) || matriceContraintes[i][j] == T(0)) continue;
+            T terme = matriceContraintes[i][j] * r[j];
+            produit += terme;
+            echelleLigne += TraitsScalaire<T>::abs(terme);
+        }
+        T tolerance = EPSILON * (T(1) + echelleLigne);
+        bool egalite = typesContraintes[i] == EQ || ligneIntervalle[i];
+        if ((typesContraintes[i] == LEQ || egalite) && tolerance < produit) return;
+        if ((typesContraintes[i] == GEQ || egalite) && produit < -tolerance) return;
+    }
 
-        // Generate variable name on-the-fly
-        int varCount = 0;
-        bool found = false;
-        for (int j = 0; j < nbVariablesOriginales; j++) {
-            if (typesVariables[j] == UNRESTRICTED) {
-                if (i == varCount) {
-                    cout << "x" << (j + 1) << "'";
-                    found = true;
-                    break;
-                } else if (i == varCount + 1) {
-                    cout << "x" << (j + 1) << "''";
-                    found = true;
-                    break;
-                }
-                varCount += 2;
-            } else if (typesVariables[j] == NON_POSITIVE) {
-                if (i == varCount) {
-                    cout << "(-x" << (j + 1) << ")";
-                    found = true;
-                    break;
-                }
-                varCount++;
-            } else { // NON_NEGATIVE
-                if (i == varCount) {
-                    cout << "x" << (j + 1);
-                    found = true;
-                    break;
-                }
-                varCount++;
+    rayonNonBorne.resize(nbVariablesOriginales);
+    for (int j = 0; j < nbVariablesOriginales; j++) {
+        rayonNonBorne[j] = colonneInversee[j] ? -r[j] : r[j];
+    }
+}
+
+template<typename T>
+void SimplexSolverT<T>::appliquerSolutionFormeStandard(const vector<T>& xStandard) {
+    Vecteur<T> transformedSolution(xStandard.begin(), xStandard.begin() + nbVariablesDecision, &temporaires);
+
+    valeurObjectif = T(0);
+    for (int j = 0; j < nbVariablesDecision; j++) {
+        valeurObjectif += fonctionObjectif[j] * transformedSolution[j];
+    }
+    convertirSolutionTransformee(transformedSolution);
+}
+
+template<typename T>
+int SimplexSolverT<T>::getNbColonnesFormeStandard() const {
+    int nbEcart = 0;
+    for (auto type : typesContraintes) {
+        if (type == LEQ || type == GEQ) nbEcart++;
+    }
+    return nbVariablesDecision + nbEcart;
+}
+
+template<typename T>
+vector<T> SimplexSolverT<T>::getColonneFormeStandard(int j) const {
+    vector<T> colonne(nbContraintes, T(0));
+
+    if (j < nbVariablesDecision) {
+        for (int i = 0; i < nbContraintes; i++) {
+            colonne[i] = matriceContraintes[i][j];
+        }
+        return colonne;
+    }
+
+    // Variables d'écart (t_k) dans l'ordre des lignes LEQ/GEQ
+    int k = j - nbVariablesDecision;
+    for (int i = 0; i < nbContraintes; i++) {
+        if (typesContraintes[i] == EQ) continue;
+        if (k == 0) {
+            colonne[i] = (typesContraintes[i] == LEQ) ? T(1) : T(-1);
+            break;
+        }
+        k--;
+    }
+    return colonne;
+}
+
+template<typename T>
+T SimplexSolverT<T>::getCoutFormeStandard(int j) const {
+    if (j >= nbVariablesDecision) return T(0);
+    // Coût par morceaux: pente du segment courant, dans le sens saisi
+    if (estMorcelee(j)) {
+        const T& pente = pentesMorceaux[j][segmentMorceau(j)];
+        return (typeObj == MAX) ? -pente : pente;
+    }
+    return fonctionObjectif[j];
+}
+
+template<typename T>
+bool SimplexSolverT<T>::calculerValeursDuales(vector<T>& duales) const {
+    // GUB: les lignes d'ensemble ne sont plus dans le tableau
+    if (etatSolution != OPTIMALE || !secondMembreGub.empty()) return false;
+
+    int m = nbContraintes;
+    int n = getNbColonnesFormeStandard();
+
+    // Une artificielle restée en base (niveau 0) n'a pas de colonne dans
+    // la forme standard: elle garde la sienne, e_r de coût nul
+    vector<vector<T>> B(m, vector<T>(m));
+    vector<T> cB(m);
+    size_t artificielle = 0;
+    for (int k = 0; k < m; k++) {
+        if (base[k] < 0) {
+            if (artificielle == lignesArtificiellesEnBase.size()) return false;
+            B[lignesArtificiellesEnBase[artificielle++]][k] = T(1);
+            cB[k] = T(0);
+            continue;
+        }
+        if (base[k] >= n) return false;
+        vector<T> colonne = getColonneFormeStandard(base[k]);
+        for (int i = 0; i < m; i++) {
+            B[i][k] = colonne[i];
+        }
+        cB[k] = getCoutFormeStandard(base[k]);
+    }
+
+    FactorisationLU<T> lu;
+    if (!lu.factoriser(B)) return false;
+
+    // B^T y = c_B, puis retour au signe des lignes saisies
+    vector<T> y = lu.resoudreTransposee(cB);
+    duales.resize(m);
+    for (int i = 0; i < m; i++) {
+        duales[i] = lignesInversees[i] ? -y[i] : y[i];
+    }
+    return true;
+}
+
+template<typename T>
+void SimplexSolverT<T>::solveDepuisBase(const vector<int>& baseInitiale) {
+    debuterResolution();
+    if (intervalleVide) {
+        resoudre();
+        return;
+    }
+
+    journal() << "\n" << LIGNE_SEPARATION << endl;
+    journal() << "RESOLUTION A PARTIR D'UNE BASE DONNEE" << endl;
+    journal() << LIGNE_SEPARATION << "\n";
+
+    initialiserTableau();
+    retirerVariablesArtificielles();
+    lignesArtificiellesEnBase.clear();   // aucune n'a été en base
+
+    // Refactorisation: Gauss-Jordan sur les colonnes de la base fournie
+    Vecteur<bool> ligneFixee(nbContraintes, false, &temporaires);
+    Vecteur<bool> dansBase(nbVariablesTotal, false, &temporaires);
+    for (int colonne : baseInitiale) {
+        if (colonne >= 0 && colonne < nbVariablesTotal) dansBase[colonne] = true;
+    }
+    // Seules les lignes LEQ ont déjà une variable de base valide (leur écart)
+    for (int i = 0; i < nbContraintes; i++) {
+        if (typesContraintes[i] == LEQ && dansBase[base[i]]) {
+            ligneFixee[i] = true;
+            dansBase[base[i]] = false;
+        }
+    }
+
+    for (int colonne = 0; colonne < nbVariablesTotal; colonne++) {
+        if (!dansBase[colonne]) continue;
+
+        int lignePivot = -1;
+        T maxVal = T(0);
+        for (int i = 0; i < nbContraintes; i++) {
+            if (ligneFixee[i]) continue;
+            T val = TraitsScalaire<T>::abs(tableau[i][colonne]);
+            if (val > EPSILON && (lignePivot == -1 || val > maxVal)) {
+                maxVal = val;
+                lignePivot = i;
             }
         }
+        if (lignePivot == -1) break; // base singulière
+
+        pivoter(lignePivot, colonne);
+        base[lignePivot] = colonne;
+        ligneFixee[lignePivot] = true;
+    }
 
-        if (!found) {
-            cout << "x" << (i + 1); // fallback
+    // Base incomplète (ligne sans variable de base valide) ou non réalisable:
+    // on repart d'une résolution complète
+    bool baseValide = true;
+    for (int i = 0; i < nbContraintes && baseValide; i++) {
+        if (!ligneFixee[i] && typesContraintes[i] != LEQ) {
+            baseValide = false;
+        } else if (!estLibre(base[i]) && tableau[i][nbVariablesTotal] < -EPSILON) {
+            baseValide = false;
+        } else if (estBornee(base[i]) && tableau[i][nbVariablesTotal] > borneColonne[base[i]] + EPSILON) {
+            baseValide = false;
         }
     }
 
+    if (!baseValide) {
+        journal() << "\nBase fournie inutilisable: resolution complete.\n";
+        tableau.clear();
+        resoudre();
+        return;
+    }
+
+    journal() << "\n=== PHASE 2: Optimisation de la fonction objectif ===\n";
+    initialiserObjectifPhase2();
+    iterationsPhase2();
+    if (etatSolution == OPTIMALE || interrompu) extraireSolution();
+    afficherSolution();
+}
+
+template<typename T>
+void SimplexSolverT<T>::afficherFormeStandard() const {
+    journal() << "\n--- FORME STANDARD (apres transformation) ---\n\n";
+
+    journal() << (typeObj == MAX ? "Max" : "Min") << " Z = ";
+    for (int i = 0; i < nbVariablesDecision; i++) {
+        if (i > 0 && fonctionObjectif[i] >= 0) journal() << " + ";
+        else if (i > 0) journal() << " ";
+
+        journal() << fonctionObjectif[i] << "*" << nomVariableDecision(i);
+    }
+
     int idxVariable = 1;
     for (auto type : typesContraintes) {
         if (type == LEQ || type == GEQ) {
-            cout << " + 0*t" << idxVariable++;
+            journal() << " + 0*t" << idxVariable++;
         }
     }
 
-    cout << "\n\nAvec:\n";
+    journal() << "\n\nAvec:\n";
 
     idxVariable = 1;
     for (int i = 0; i < nbContraintes; i++) {
-        cout << "  ";
+        journal() << "  ";
         for (int j = 0; j < nbVariablesDecision; j++) {
-            if (j > 0 && matriceContraintes[i][j] >= 0) cout << " + ";
-            else if (j > 0) cout << " ";
-
-            cout << matriceContraintes[i][j] << "*";
-
-            // Generate variable name on-the-fly
-            int varCount = 0;
-            bool found = false;
-            for (int k = 0; k < nbVariablesOriginales; k++) {
-                if (typesVariables[k] == UNRESTRICTED) {
-                    if (j == varCount) {
-                        cout << "x" << (k + 1) << "'";
-                        found = true;
-                        break;
-                    } else if (j == varCount + 1) {
-                        cout << "x" << (k + 1) << "''";
-                        found = true;
-                        break;
-                    }
-                    varCount += 2;
-                } else if (typesVariables[k] == NON_POSITIVE) {
-                    if (j == varCount) {
-                        cout << "(-x" << (k + 1) << ")";
-                        found = true;
-                        break;
-                    }
-                    varCount++;
-                } else { // NON_NEGATIVE
-                    if (j == varCount) {
-                        cout << "x" << (k + 1);
-                        found = true;
-                        break;
-                    }
-                    varCount++;
-                }
-            }
+            if (j > 0 && matriceContraintes[i][j] >= 0) journal() << " + ";
+            else if (j > 0) journal() << " ";
 
-            if (!found) {
-                cout << "x" << (j + 1); // fallback
-            }
+            journal() << matriceContraintes[i][j] << "*" << nomVariableDecision(j);
         }
 
-        if (typesContraintes[i] == LEQ) {
-            cout << " + t" << idxVariable++ << " = " << Bi[i];
-        } else if (typesContraintes[i] == GEQ) {
-            cout << " - t" << idxVariable++ << " = " << Bi[i];
+        if (typesContraintes[i] == LEQ || typesContraintes[i] == GEQ) {
+            journal() << (typesContraintes[i] == LEQ ? " + t" : " - t") << idxVariable << " = " << Bi[i];
+            if (ligneIntervalle[i]) journal() << ",  t" << idxVariable << " <= " << etendueLigne[i];
+            idxVariable++;
         } else {
-            cout << " = " << Bi[i];
+            journal() << " = " << Bi[i];
         }
-        cout << endl;
+        journal() << endl;
     }
 
-    cout << "\n  Toutes les variables transformees >= 0\n";
+    journal() << "\n  Toutes les variables transformees >= 0";
+    afficherVariablesLibres();
+    journal() << "\n";
 }
 
-void SimplexSolver::afficherIntroductionVariablesArtificielles() const {
+template<typename T>
+void SimplexSolverT<T>::afficherVariablesLibres() const {
+    bool premiere = true;
+    for (int j = 0; j < nbVariablesDecision; j++) {
+        if (!variableLibre[j]) continue;
+        journal() << (premiere ? ", sauf " : ", ") << nomVariableDecision(j);
+        premiere = false;
+    }
+    if (!premiere) journal() << " (libres: jamais bloquees au test du rapport)";
+}
+
+template<typename T>
+string SimplexSolverT<T>::nomVariableDecision(int j) const {
+    string nom = "x" + to_string(j + 1);
+    return typesVariables[j] == NON_POSITIVE ? "(-" + nom + ")" : nom;
+}
+
+template<typename T>
+void SimplexSolverT<T>::afficherIntroductionVariablesArtificielles() const {
     if (nbVariablesArtificielles == 0) {
-        cout << "\n--- PAS DE VARIABLES ARTIFICIELLES NECESSAIRES ---\n";
-        cout << "Toutes les contraintes sont de type <=, donc pas besoin de Phase 1.\n";
+        journal() << "\n--- PAS DE VARIABLES ARTIFICIELLES NECESSAIRES ---\n";
+        journal() << "Toutes les contraintes sont de type <=, donc pas besoin de Phase 1.\n";
         return;
     }
 
-    cout << "\n--- INTRODUCTION DES VARIABLES ARTIFICIELLES ---\n\n";
+    journal() << "\n--- INTRODUCTION DES VARIABLES ARTIFICIELLES ---\n\n";
 
     int idxVariable = 1, idxArtif = 1;
     for (int i = 0; i < nbContraintes; i++) {
-        cout << "  ";
+        journal() << "  ";
         for (int j = 0; j < nbVariablesDecision; j++) {
-            if (j > 0 && matriceContraintes[i][j] >= 0) cout << " + ";
-            else if (j > 0) cout << " ";
-
-            cout << matriceContraintes[i][j] << "*";
-
-            // Generate variable name
-            int varCount = 0;
-            bool found = false;
-            for (int k = 0; k < nbVariablesOriginales; k++) {
-                if (typesVariables[k] == UNRESTRICTED) {
-                    if (j == varCount) {
-                        cout << "x" << (k + 1) << "'";
-                        found = true;
-                        break;
-                    } else if (j == varCount + 1) {
-                        cout << "x" << (k + 1) << "''";
-                        found = true;
-                        break;
-                    }
-                    varCount += 2;
-                } else if (typesVariables[k] == NON_POSITIVE) {
-                    if (j == varCount) {
-                        cout << "(-x" << (k + 1) << ")";
-                        found = true;
-                        break;
-                    }
-                    varCount++;
-                } else {
-                    if (j == varCount) {
-                        cout << "x" << (k + 1);
-                        found = true;
-                        break;
-                    }
-                    varCount++;
-                }
-            }
+            if (j > 0 && matriceContraintes[i][j] >= 0) journal() << " + ";
+            else if (j > 0) journal() << " ";
 
-            if (!found) cout << "x" << (j + 1);
+            journal() << matriceContraintes[i][j] << "*" << nomVariableDecision(j);
         }
 
         if (typesContraintes[i] == LEQ) {
-            cout << " + t" << idxVariable++ << " = " << Bi[i];
+            journal() << " + t" << idxVariable++ << " = " << Bi[i];
         } else if (typesContraintes[i] == GEQ) {
-            cout << " - t" << idxVariable++ << " + w" << idxArtif++ << " = " << Bi[i];
+            journal() << " - t" << idxVariable++ << " + w" << idxArtif++ << " = " << Bi[i];
         } else {
-            cout << " + w" << idxArtif++ << " = " << Bi[i];
+            journal() << " + w" << idxArtif++ << " = " << Bi[i];
         }
-        cout << endl;
+        journal() << endl;
     }
 
     // Print all variable names
-    cout << "\n  ";
-    int varCount = 0;
-    for (int j = 0; j < nbVariablesOriginales; j++) {
-        if (j > 0) cout << ", ";
-
-        if (typesVariables[j] == UNRESTRICTED) {
-            cout << "x" << (j + 1) << "', x" << (j + 1) << "''";
-        } else if (typesVariables[j] == NON_POSITIVE) {
-            cout << "(-x" << (j + 1) << ")";
-        } else {
-            cout << "x" << (j + 1);
-        }
+    journal() << "\n  ";
+    for (int j = 0; j < nbVariablesDecision; j++) {
+        if (j > 0) journal() << ", ";
+        journal() << nomVariableDecision(j);
     }
 
     // Count slack variables
@@ -754,32 +2542,78 @@ void SimplexSolver::afficherIntroductionVariablesArtificielles() const {
 
     if (totalVariablesEcart > 0) {
         for (int i = 1; i <= totalVariablesEcart; i++) {
-            cout << ", t" << i;
+            journal() << ", t" << i;
         }
     }
 
     if (idxArtif > 1) {
         for (int i = 1; i < idxArtif; i++) {
-            cout << ", w" << i;
+            journal() << ", w" << i;
         }
     }
 
-    cout << " >= 0\n";
+    journal() << " >= 0";
+    afficherVariablesLibres();
+    journal() << "\n";
 }
 
-void SimplexSolver::solve() {
-    cout << "\n" << string(80, '=') << endl;
-    cout << "RESOLUTION PAR L'ALGORITHME DU SIMPLEXE" << endl;
-    cout << string(80, '=') << "\n";
+template<typename T>
+void SimplexSolverT<T>::solve() {
+    debuterResolution();
+    resoudre();
+}
+
+template<typename T>
+void SimplexSolverT<T>::reoptimiser() {
+    // Lu avant debuterResolution(), qui efface l'état de l'appel précédent.
+    // Après un arrêt en phase 1 ou une infaisabilité, le tableau n'a pas
+    // de base réalisable: résolution complète
+    bool baseReprise = baseReprenable();
+    debuterResolution();
+    if (!baseReprise) {
+        tableau.clear();
+        resoudre();
+        return;
+    }
+
+    journal() << "\n" << LIGNE_SEPARATION << endl;
+    journal() << "REOPTIMISATION A PARTIR DE LA BASE COURANTE" << endl;
+    journal() << LIGNE_SEPARATION << "\n";
+
+    // Base réalisable inchangée: seule la ligne des coûts est recalculée
+    journal() << "\n=== PHASE 2: Optimisation de la fonction objectif ===\n";
+    initialiserObjectifPhase2();
+    iterationsPhase2();
+    extraireSolution();
+    afficherSolution();
+}
+
+template<typename T>
+void SimplexSolverT<T>::resoudre() {
+    journal() << "\n" << LIGNE_SEPARATION << endl;
+    journal() << "RESOLUTION PAR L'ALGORITHME DU SIMPLEXE" << endl;
+    journal() << LIGNE_SEPARATION << "\n";
 
     afficherProbleme();
+    if (intervalleVide) {
+        journal() << "\nUne contrainte RANGE a une borne inferieure superieure a sa borne superieure.\n";
+        etatSolution = INFAISABLE;
+        afficherSolution();
+        return;
+    }
     afficherFormeStandard();
+    // Extraction une seule fois: le modèle transformé n'a plus ces lignes
+    if (modeGub && secondMembreGub.empty()) extraireLignesGub();
     initialiserTableau();
     afficherIntroductionVariablesArtificielles();
 
     if (nbVariablesArtificielles > 0) {
-        phase1();
-        if (etatSolution == INFAISABLE) {
+        // La ligne des coûts composite ignore les points de rupture
+        if (modeComposite && nbVariablesMorcelees == 0) phaseComposite();
+        else phase1();
+        // Limite en phase 1: aucune base réalisable à rendre
+        if (interrompu || etatSolution == INFAISABLE) {
+            if (etatSolution == INFAISABLE) extraireRayonFarkas();
             afficherSolution();
             return;
         }
@@ -790,114 +2624,199 @@ void SimplexSolver::solve() {
     afficherSolution();
 }
 
-void SimplexSolver::afficherProbleme() const {
-    cout << "\n--- PROBLEME DE PROGRAMMATION LINEAIRE ---\n\n";
+template<typename T>
+void SimplexSolverT<T>::afficherProbleme() const {
+    journal() << "\n--- PROBLEME DE PROGRAMMATION LINEAIRE ---\n\n";
 
-    cout << (typeObj == MAX ? "Maximiser" : "Minimiser") << " Z = ";
+    journal() << (typeObj == MAX ? "Maximiser" : "Minimiser") << " Z = ";
     for (int i = 0; i < nbVariablesOriginales; i++) {
-        if (i > 0 && fonctionObjectif[i] >= 0) cout << " + ";
-        else if (i > 0) cout << " ";
-        cout << fonctionObjectif[i] << "*x" << (i + 1);
+        if (i > 0 && fonctionObjectif[i] >= 0) journal() << " + ";
+        else if (i > 0) journal() << " ";
+        journal() << fonctionObjectif[i] << "*x" << (i + 1);
     }
-    cout << "\n\nSous les contraintes:\n";
+    for (int j = 0; j < nbVariablesDecision; j++) {
+        if (!estMorcelee(j)) continue;
+        journal() << "\n  Cout par morceaux de x" << (j + 1) << ": pentes";
+        for (size_t k = 0; k < pentesMorceaux[j].size(); k++) {
+            journal() << (k == 0 ? " " : ", ") << (typeObj == MAX ? -pentesMorceaux[j][k] : pentesMorceaux[j][k]);
+        }
+        journal() << " (ruptures en";
+        for (size_t k = 1; k < pointsRupture[j].size(); k++) {
+            journal() << (k == 1 ? " " : ", ") << pointsRupture[j][k];
+        }
+        journal() << ")";
+    }
+    journal() << "\n\nSous les contraintes:\n";
 
     for (int i = 0; i < nbContraintes; i++) {
-        cout << "  ";
+        journal() << "  ";
         for (int j = 0; j < nbVariablesOriginales; j++) {
-            if (j > 0 && matriceContraintes[i][j] >= 0) cout << " + ";
-            else if (j > 0) cout << " ";
-            cout << matriceContraintes[i][j] << "*x" << (j + 1);
+            if (j > 0 && matriceContraintes[i][j] >= 0) journal() << " + ";
+            else if (j > 0) journal() << " ";
+            journal() << matriceContraintes[i][j] << "*x" << (j + 1);
+        }
+
+        if (ligneIntervalle[i]) {
+            T l = (typesContraintes[i] == LEQ) ? Bi[i] - etendueLigne[i] : Bi[i];
+            journal() << " dans [" << l << ", " << l + etendueLigne[i] << "]" << endl;
+            continue;
         }
 
-        if (typesContraintes[i] == LEQ) cout << " <= ";
-        else if (typesContraintes[i] == GEQ) cout << " >= ";
-        else cout << " = ";
+        if (typesContraintes[i] == LEQ) journal() << " <= ";
+        else if (typesContraintes[i] == GEQ) journal() << " >= ";
+        else journal() << " = ";
 
-        cout << Bi[i] << endl;
+        journal() << Bi[i] << endl;
     }
 
-    cout << "\n  Contraintes de signe:\n";
+    journal() << "\n  Contraintes de signe:\n";
     for (int i = 0; i < nbVariablesOriginales; i++) {
-        cout << "  x" << (i + 1) << " ";
+        journal() << "  x" << (i + 1) << " ";
         if (typesVariables[i] == NON_NEGATIVE) {
-            cout << ">= 0";
+            journal() << ">= 0";
         } else if (typesVariables[i] == NON_POSITIVE) {
-            cout << "<= 0";
+            journal() << "<= 0";
         } else {
-            cout << "s.r.s. (sans restriction de signe)";
+            journal() << "s.r.s. (sans restriction de signe)";
         }
-        cout << endl;
+        journal() << endl;
     }
 }
 
-void SimplexSolver::afficherTableau(int iteration, bool isPhase1) const {
-    string phaseLabel = isPhase1 ? " (Phase 1)" : " (Phase 2)";
+template<typename T>
+void SimplexSolverT<T>::afficherTableau(int iteration, bool isPhase1) const {
+    if (modeSilencieux) return;
+
+    bool composite = static_cast<int>(tableau.size()) > nbContraintes + 1;
+    string phaseLabel = composite ? " (Composite)" : isPhase1 ? " (Phase 1)" : " (Phase 2)";
 
     if (iteration == 0) {
-        cout << "\n--- TABLEAU INITIAL" << phaseLabel << " ---\n";
+        journal() << "\n--- TABLEAU INITIAL" << phaseLabel << " ---\n";
     } else {
-        cout << "\n--- Iteration " << iteration << phaseLabel << " ---\n";
+        journal() << "\n--- Iteration " << iteration << phaseLabel << " ---\n";
     }
 
-    cout << setw(8) << "Base" << " | ";
+    journal() << setw(8) << "Base" << " | ";
 
     int nbColonnes = tableau[0].size() - 1;
 
     for (int j = 0; j < nbColonnes; j++) {
-        cout << setw(10) << nomsVariables[j];
+        journal() << setw(10) << nomsVariables[j];
     }
-    cout << setw(10) << "b" << endl;
-    cout << string(12 + 10 * (nbColonnes + 1), '-') << endl;
+    journal() << setw(10) << "b" << endl;
+    journal() << string(12 + 10 * (nbColonnes + 1), '-') << endl;
 
     for (int i = 0; i < nbContraintes; i++) {
-        cout << setw(8) << nomsVariables[base[i]] << " | ";
+        journal() << setw(8) << (base[i] >= 0 ? nomsVariables[base[i]] : string("-")) << " | ";
         for (int j = 0; j < nbColonnes; j++) {
-            cout << setw(10) << fixed << setprecision(3) << tableau[i][j];
+            journal() << setw(10) << fixed << setprecision(3) << tableau[i][j];
         }
-        cout << setw(10) << fixed << setprecision(3) << tableau[i][nbColonnes] << endl;
+        journal() << setw(10) << fixed << setprecision(3) << tableau[i][nbColonnes] << endl;
     }
 
-    cout << string(12 + 10 * (nbColonnes + 1), '-') << endl;
+    journal() << string(12 + 10 * (nbColonnes + 1), '-') << endl;
 
     if (isPhase1) {
-        cout << setw(8) << "W" << " | ";
+        journal() << setw(8) << "W" << " | ";
     } else if (typeObj == MIN) {
-        cout << setw(8) << "zj-cj" << " | ";
+        journal() << setw(8) << "zj-cj" << " | ";
     } else {
-        cout << setw(8) << "cj-zj" << " | ";
+        journal() << setw(8) << "cj-zj" << " | ";
     }
 
     for (int j = 0; j < nbColonnes; j++) {
-        cout << setw(10) << fixed << setprecision(3) << tableau[nbContraintes][j];
+        journal() << setw(10) << fixed << setprecision(3) << tableau[nbContraintes][j];
+    }
+    journal() << setw(10) << fixed << setprecision(3) << tableau[nbContraintes][nbColonnes] << endl;
+
+    if (composite) {
+        journal() << setw(8) << (typeObj == MIN ? "zj-cj" : "cj-zj") << " | ";
+        for (int j = 0; j <= nbColonnes; j++) {
+            journal() << setw(10) << fixed << setprecision(3) << tableau[nbContraintes + 1][j];
+        }
+        journal() << endl;
+    }
+
+    for (int k = 0; k < static_cast<int>(cleGub.size()); k++) {
+        journal() << (k == 0 ? "Cles GUB: " : ", ") << nomsVariables[cleGub[k]]
+             << " = " << fixed << setprecision(3) << valeurCle(k);
     }
-    cout << setw(10) << fixed << setprecision(3) << tableau[nbContraintes][nbColonnes] << endl;
+    if (!cleGub.empty()) journal() << endl;
 }
 
-void SimplexSolver::afficherSolution() const {
-    cout << "\n" << string(80, '=') << endl;
-    cout << "SOLUTION FINALE" << endl;
-    cout << string(80, '=') << "\n\n";
+template<typename T>
+void SimplexSolverT<T>::afficherSolution() const {
+    journal() << "\n" << LIGNE_SEPARATION << endl;
+    journal() << "SOLUTION FINALE" << endl;
+    journal() << LIGNE_SEPARATION << "\n\n";
 
     if (etatSolution == OPTIMALE) {
-        cout << "*** SOLUTION OPTIMALE ATTEINTE ***\n\n";
+        journal() << "*** SOLUTION OPTIMALE ATTEINTE ***\n\n";
 
-        cout << "Valeur optimale de Z = " << fixed << setprecision(4)
+        journal() << "Valeur optimale de Z = " << fixed << setprecision(4)
              << valeurObjectif << "\n\n";
 
-        cout << "Variables de decision:\n";
+        journal() << "Variables de decision:\n";
         // FIX: Loop over ORIGINAL variables, not transformed ones!
         for (int i = 0; i < nbVariablesOriginales; i++) {
-            cout << "  x" << (i + 1) << " = " << fixed << setprecision(4)
+            journal() << "  x" << (i + 1) << " = " << fixed << setprecision(4)
             << solutionOptimale[i] << endl;
         }
     } else if (etatSolution == NON_BORNE) {
-        cout << "*** PROBLEME NON BORNE ***\n";
-        cout << "La fonction objectif peut etre amelioree indefiniment.\n";
+        journal() << "*** PROBLEME NON BORNE ***\n";
+        journal() << "La fonction objectif peut etre amelioree indefiniment.\n";
+        if (!rayonNonBorne.empty()) {
+            journal() << "\nRayon ameliorant r (x + t r realisable pour tout t >= 0):\n";
+            for (int j = 0; j < nbVariablesOriginales; j++) {
+                if (!(rayonNonBorne[j] == T(0))) journal() << "  r" << (j + 1) << " = " << rayonNonBorne[j] << endl;
+            }
+        }
     } else if (etatSolution == INFAISABLE) {
-        cout << "*** AUCUNE SOLUTION REALISABLE ***\n";
-        cout << "Les contraintes sont incompatibles (W > 0 en Phase 1).\n";
+        journal() << "*** AUCUNE SOLUTION REALISABLE ***\n";
+        journal() << "Les contraintes sont incompatibles (W > 0 en Phase 1).\n";
+        if (!rayonFarkas.empty()) {
+            journal() << "\nCertificat de Farkas y (sum y_i a_i.x est du signe de x, sum y_i b_i < 0):\n";
+            for (int i = 0; i < static_cast<int>(rayonFarkas.size()); i++) {
+                if (!(rayonFarkas[i] == T(0))) journal() << "  y" << (i + 1) << " = " << rayonFarkas[i] << endl;
+            }
+        }
+    } else if (etatSolution == LIMITE_ATTEINTE) {
+        journal() << "*** ARRET AVANT LA FIN: ";
+        switch (causeArret) {
+        case ARRET_ITERATIONS:     journal() << "nombre maximal d'iterations"; break;
+        case ARRET_DELAI:          journal() << "delai depasse"; break;
+        case ARRET_UNITES_TRAVAIL: journal() << "budget de travail epuise"; break;
+        default:                   journal() << "annulation demandee"; break;
+        }
+        journal() << " ***\n";
+
+        if (solutionRealisable) {
+            journal() << "Meilleure solution realisable trouvee: Z = " << fixed << setprecision(4)
+                 << valeurObjectif << "\n";
+            for (int i = 0; i < nbVariablesOriginales; i++) {
+                journal() << "  x" << (i + 1) << " = " << fixed << setprecision(4)
+                << solutionOptimale[i] << endl;
+            }
+        } else {
+            journal() << "Arret en Phase 1: aucune solution realisable connue.\n";
+        }
+    }
+
+    // Santé numérique: seulement si quelque chose mérite l'attention
+    if (sante.nbReinversions > 0 || sante.nbPivotsFaibles > 0 || sante.nbViolationsTolerance > 0) {
+        journal() << "\nSante numerique: " << sante.nbControles << " controle(s), " << sante.nbReinversions
+             << " reinversion(s), " << sante.nbPivotsFaibles << " pivot(s) faible(s), "
+             << sante.nbViolationsTolerance << " valeur(s) hors tolerance\n";
+        journal() << "  residu primal max " << scientific << setprecision(2) << sante.residuPrimalMax
+             << ", ecart des couts max " << sante.ecartCoutsMax
+             << ", conditionnement max " << sante.conditionnementMax << defaultfloat << "\n";
     }
 
-    cout << "\n" << string(80, '=') << endl;
+    journal() << "\n" << LIGNE_SEPARATION << endl;
 }
 
+// Instanciations explicites (ajouter ici les types scalaires personnalisés)
+template class SimplexSolverT<float>;
+template class SimplexSolverT<double>;
+template class SimplexSolverT<long double>;
+template class SimplexSolverT<Rationnel>;
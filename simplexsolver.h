@@ -3,31 +3,421 @@
 
 #include <vector>
 #include <string>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <memory_resource>
+#include <ostream>
+#include <cmath>
 
 enum TypeObjectif { MAX, MIN };
-enum TypeContrainte { LEQ, GEQ, EQ };
-enum TypeSolution { OPTIMALE, NON_BORNE, INFAISABLE, EN_COURS };
+enum TypeContrainte {
+    LEQ,
+    GEQ,
+    EQ,
+    RANGE   // l <= a.x <= b: une seule ligne, écart borné par b - l
+};
+enum TypeSolution { OPTIMALE, NON_BORNE, INFAISABLE, EN_COURS, LIMITE_ATTEINTE };
 enum TypeVariable {
     NON_NEGATIVE,  // x â‰¥ 0
     NON_POSITIVE,  // x â‰¤ 0
     UNRESTRICTED   // x sans restriction (s.r.s.)
 };
 
-class SimplexSolver {
-private:
+//
+// Problème linéaire immuable, partagé entre l'interface et les moteurs
+// (primal, dual, concurrent...) sans jamais être recopié: les moteurs ne
+// prennent qu'un ProblemePartage. creer() prend ses arguments par valeur:
+// avec std::move(...), aucune copie des données.
+//
+struct ProblemeLineaire {
     std::vector<double> fonctionObjectif;
     std::vector<std::vector<double>> matriceContraintes;
     std::vector<double> Bi;
     std::vector<TypeContrainte> typesContraintes;
     TypeObjectif typeObj;
+    std::vector<TypeVariable> typesVariables;   // NON_NEGATIVE si non fourni
+    std::vector<double> bornesInferieures;      // l_i des lignes RANGE (ignoré ailleurs)
+
+    static std::shared_ptr<const ProblemeLineaire> creer(std::vector<double> fobj,
+                                                         std::vector<std::vector<double>> contraintes,
+                                                         std::vector<double> b,
+                                                         std::vector<TypeContrainte> types,
+                                                         TypeObjectif type,
+                                                         std::vector<TypeVariable> typesVar = std::vector<TypeVariable>(),
+                                                         std::vector<double> bornesInf = std::vector<double>()) {
+        auto probleme = std::make_shared<ProblemeLineaire>();
+        if (typesVar.empty()) typesVar.assign(fobj.size(), NON_NEGATIVE);
+        probleme->fonctionObjectif = std::move(fobj);
+        probleme->matriceContraintes = std::move(contraintes);
+        probleme->Bi = std::move(b);
+        probleme->typesContraintes = std::move(types);
+        probleme->typeObj = type;
+        probleme->typesVariables = std::move(typesVar);
+        probleme->bornesInferieures = std::move(bornesInf);
+        return probleme;
+    }
+
+    int nbLignesIntervalle() const {
+        int nb = 0;
+        for (TypeContrainte type : typesContraintes) {
+            if (type == RANGE) nb++;
+        }
+        return nb;
+    }
+
+    // Pour les moteurs sans lignes RANGE natives: chaque l <= a.x <= b
+    // devient a.x <= b (même indice) et a.x >= l, ajoutée à la fin dans
+    // l'ordre des lignes RANGE. Sans ligne RANGE, rend le même problème.
+    static std::shared_ptr<const ProblemeLineaire> sansIntervalles(std::shared_ptr<const ProblemeLineaire> probleme) {
+        if (probleme->nbLignesIntervalle() == 0) return probleme;
+
+        auto developpe = std::make_shared<ProblemeLineaire>(*probleme);
+        developpe->bornesInferieures.clear();
+        for (std::size_t i = 0; i < probleme->typesContraintes.size(); i++) {
+            if (probleme->typesContraintes[i] != RANGE) continue;
+            developpe->typesContraintes[i] = LEQ;
+            developpe->matriceContraintes.push_back(probleme->matriceContraintes[i]);
+            developpe->Bi.push_back(probleme->bornesInferieures[i]);
+            developpe->typesContraintes.push_back(GEQ);
+        }
+        return developpe;
+    }
+
+    // Contrôle d'une paire (x, y) lue sur une base optimale, y ayant une
+    // valeur par ligne (problème sans lignes RANGE, voir sansIntervalles):
+    // plus forte violation d'une contrainte ou d'un signe de x, et écart
+    // |c.x - b.y|. Acceptée si l'écart reste sous tolerance * (1 + |b.y|)
+    // et la violation sous tolerance * (1 + max |b_i|)
+    struct ControlePaire {
+        double valeurPrimal;    // c.x
+        double valeurDual;      // b.y
+        double residuPrimal;
+        double ecartDualite;
+        bool verifiee;
+    };
+    ControlePaire controlerPaire(const std::vector<double>& x, const std::vector<double>& y,
+                                 double tolerance) const;
+
+    // Valeurs duales du problème développé ramenées aux lignes d'origine:
+    // le prix d'une ligne RANGE est la somme de ceux de ses deux moitiés
+    template<typename U>
+    void replierValeursDuales(std::vector<U>& duales) const {
+        std::size_t k = typesContraintes.size();
+        if (duales.size() <= k) return;
+        for (std::size_t i = 0; i < typesContraintes.size(); i++) {
+            if (typesContraintes[i] == RANGE) duales[i] += duales[k++];
+        }
+        duales.resize(typesContraintes.size());
+    }
+};
+
+using ProblemePartage = std::shared_ptr<const ProblemeLineaire>;
+
+// Journal commun à tous les moteurs: std::cout, ou en mode silencieux un
+// flux qui ignore toute écriture
+std::ostream& fluxJournal(bool silencieux);
+
+//
+// Vue non propriétaire d'un problème, lue coefficient par coefficient par
+// SimplexSolverT: le problème tel quel, ou son dual lu directement dans
+// le stockage du primal (transposée implicite: a_ij du dual = a_ji du
+// primal), sans rien recopier. Les données vues doivent survivre à la vue.
+//
+// Dual d'un primal sans ligne RANGE (voir sansIntervalles): une ligne
+// par variable primale, une variable par contrainte primale, objectif
+// b, seconds membres c et sens inverse; types de lignes selon le signe
+// des variables primales, signes des variables selon les lignes.
+//
+class VueProblemeLineaire {
+private:
+    const std::vector<double>* fonctionObjectif;
+    const std::vector<std::vector<double>>* matriceContraintes;
+    const std::vector<double>* Bi;
+    const std::vector<TypeContrainte>* typesContraintes;
+    const std::vector<TypeVariable>* typesVariables;   // vide: NON_NEGATIVE
+    const std::vector<double>* bornesInferieures;
+    TypeObjectif typeObj;
+    bool duale;
+
+    TypeVariable typeVariablePrimale(int j) const {
+        return typesVariables->empty() ? NON_NEGATIVE : (*typesVariables)[j];
+    }
+
+public:
+    VueProblemeLineaire(const std::vector<double>& fobj,
+                        const std::vector<std::vector<double>>& contraintes,
+                        const std::vector<double>& b,
+                        const std::vector<TypeContrainte>& types,
+                        TypeObjectif type,
+                        const std::vector<TypeVariable>& typesVar,
+                        const std::vector<double>& bornesInf)
+        : fonctionObjectif(&fobj), matriceContraintes(&contraintes), Bi(&b), typesContraintes(&types),
+        typesVariables(&typesVar), bornesInferieures(&bornesInf), typeObj(type), duale(false) {}
+
+    explicit VueProblemeLineaire(const ProblemeLineaire& probleme)
+        : VueProblemeLineaire(probleme.fonctionObjectif, probleme.matriceContraintes, probleme.Bi,
+                              probleme.typesContraintes, probleme.typeObj, probleme.typesVariables,
+                              probleme.bornesInferieures) {}
+
+    static VueProblemeLineaire dual(const ProblemeLineaire& primal) {
+        VueProblemeLineaire vue(primal);
+        vue.duale = true;
+        return vue;
+    }
+
+    bool estDuale() const { return duale; }
+    int getNbContraintes() const {
+        return static_cast<int>(duale ? fonctionObjectif->size() : matriceContraintes->size());
+    }
+    int getNbVariables() const {
+        return static_cast<int>(duale ? matriceContraintes->size() : fonctionObjectif->size());
+    }
+    TypeObjectif getTypeObjectif() const { return duale ? (typeObj == MAX ? MIN : MAX) : typeObj; }
+
+    double coefficient(int i, int j) const { return duale ? (*matriceContraintes)[j][i] : (*matriceContraintes)[i][j]; }
+    double coutVariable(int j) const { return duale ? (*Bi)[j] : (*fonctionObjectif)[j]; }
+    double secondMembre(int i) const { return duale ? (*fonctionObjectif)[i] : (*Bi)[i]; }
+
+    TypeContrainte typeContrainte(int i) const {
+        if (!duale) return (*typesContraintes)[i];
+        switch (typeVariablePrimale(i)) {
+        case NON_NEGATIVE: return (typeObj == MAX) ? GEQ : LEQ;
+        case NON_POSITIVE: return (typeObj == MAX) ? LEQ : GEQ;
+        default:           return EQ;
+        }
+    }
+    TypeVariable typeVariable(int j) const {
+        if (!duale) return typeVariablePrimale(j);
+        switch ((*typesContraintes)[j]) {
+        case LEQ: return (typeObj == MAX) ? NON_NEGATIVE : NON_POSITIVE;
+        case GEQ: return (typeObj == MAX) ? NON_POSITIVE : NON_NEGATIVE;
+        default:  return UNRESTRICTED;
+        }
+    }
+    // Borne l_i d'une ligne RANGE (jamais dans un dual), ou absente
+    bool aBorneInferieure(int i) const { return !duale && i < static_cast<int>(bornesInferieures->size()); }
+    double borneInferieure(int i) const { return (*bornesInferieures)[i]; }
+
+    // Vérification des certificats en un passage sur les coefficients non
+    // nuls du support, à une tolérance relative à l'échelle de chaque somme.
+    // Farkas (infaisabilité): y_i >= 0 (LEQ), <= 0 (GEQ), libre (EQ,
+    // RANGE); y.a_j >= 0 si x_j >= 0, <= 0 si x_j <= 0, = 0 si x_j libre;
+    // sum y_i b_i < 0, avec u_i (y_i > 0) ou l_i (y_i < 0) pour RANGE
+    bool estRayonFarkas(const std::vector<double>& y, double tolerance = 1e-9) const;
+    // Rayon améliorant (non-bornitude d'un problème réalisable): a_i.r <= 0
+    // (LEQ), >= 0 (GEQ), = 0 (EQ, RANGE); r_j du signe de x_j; c.r > 0
+    // en MAX, < 0 en MIN
+    bool estRayonNonBorne(const std::vector<double>& r, double tolerance = 1e-9) const;
+};
+
+//
+// Budgets de résolution (0 = pas de limite). Une unité de travail est la
+// mise à jour d'un coefficient du tableau: contrairement au temps, ce
+// budget donne le même point d'arrêt d'une exécution à l'autre.
+//
+struct LimitesResolution {
+    int maxIterations = 0;
+    double delaiMaxMs = 0;
+    long long maxUnitesTravail = 0;
+};
+
+enum CauseArret {
+    ARRET_AUCUN,
+    ARRET_ITERATIONS,
+    ARRET_DELAI,
+    ARRET_UNITES_TRAVAIL,
+    ARRET_ANNULATION
+};
+
+// Jeton d'annulation partageable entre threads: toutes les copies
+// désignent le même drapeau. annuler() peut être appelé de n'importe où.
+class JetonAnnulation {
+private:
+    std::shared_ptr<std::atomic<bool>> drapeau;
+
+public:
+    JetonAnnulation() : drapeau(std::make_shared<std::atomic<bool>>(false)) {}
+
+    void annuler() const { drapeau->store(true, std::memory_order_relaxed); }
+    bool estAnnule() const { return drapeau->load(std::memory_order_relaxed); }
+    std::shared_ptr<const std::atomic<bool>> getDrapeau() const { return drapeau; }
+};
+
+//
+// Santé numérique d'une résolution (remise à zéro par solve(),
+// solveDepuisBase() et reoptimiser()). Tous les pivots sont mesurés; le
+// tableau est contrôlé tous les periodeControle pivots (plus tôt après un
+// pivot faible) et avant de conclure à l'optimum de chaque phase:
+//  - résidu primal ||b - A x||_inf / (1 + ||b||_inf) au point courant;
+//  - écart des coûts réduits stockés à c - c_B B^-1 A recalculé,
+//    rapporté à 1 + ||c||_inf;
+//  - kappa_1(B) estimé par ||B||_1 max_j ||B^-1 a_j||_1 / ||a_j||_1
+//    (exact tant que chaque ligne garde sa colonne d'écart ou
+//    d'artificielle, minorant sinon).
+// Au-delà de TraitsScalaire<T>::seuilDerive(), résidu ou écart
+// déclenchent une réinversion: le tableau est reconstruit depuis le
+// modèle pour la base courante.
+// Arithmétique exacte et mode GUB: pivots mesurés, pas de contrôle.
+//
+struct SanteNumerique {
+    int nbControles = 0;
+    int nbReinversions = 0;
+    double residuPrimalMax = 0;
+    double ecartCoutsMax = 0;
+    double conditionnementMax = 0;
+    double conditionnementFinal = 0;
+    // Au dernier contrôle de fin de phase: coût réduit du mauvais signe
+    // (relatif) et valeur de base hors de ses bornes (relative)
+    double infaisabiliteDuale = 0;
+    double infaisabilitePrimale = 0;
+    // Valeurs hors tolérance relevées, contrôle par contrôle
+    int nbViolationsTolerance = 0;
 
-    std::vector<TypeVariable> typesVariables;
-    std::vector<int> variableMapping;
+    // |pivot|, et |pivot| rapporté au plus grand |a_iq| de sa colonne
+    int nbPivots = 0;
+    double pivotMin = 0;
+    double pivotMax = 0;
+    double pivotRelatifMin = 0;
+    int nbPivotsFaibles = 0;   // relatif < SEUIL_PIVOT_FAIBLE
+};
+
+//
+// Traits du type scalaire utilisé par le moteur: tolérance, valeur absolue,
+// conversion depuis les données du modèle (toujours saisies en double) et
+// vers double (mesures de SanteNumerique).
+// seuilDerive() est la dérive relative (résidu primal, écart des coûts
+// réduits, voir SanteNumerique) au-delà de laquelle le tableau est
+// reconstruit: de l'ordre de sqrt(eps machine), au-dessus de l'arrondi
+// ordinaire de quelques pivots mal conditionnés et en deçà d'une erreur
+// qui fausserait la conclusion. Il est distinct d'epsilon(), seuil de
+// zéro des coefficients.
+// Pour un type personnalisé: spécialiser TraitsScalaire<T> et ajouter
+// l'instanciation explicite à la fin de simplexsolver.cpp.
+//
+template<typename T>
+struct TraitsScalaire;
+
+template<>
+struct TraitsScalaire<float> {
+    static float epsilon() { return 1e-5f; }
+    static float abs(float v) { return std::fabs(v); }
+    static float depuisDouble(double v) { return static_cast<float>(v); }
+    static double versDouble(float v) { return v; }
+    // sqrt(1.2e-7) = 3.5e-4 laisserait passer des dérives qui changent
+    // la conclusion: le float garde le seuil de ses coefficients nuls
+    static double seuilDerive() { return 1e-5; }
+};
+
+template<>
+struct TraitsScalaire<double> {
+    static double epsilon() { return 1e-10; }
+    static double abs(double v) { return std::fabs(v); }
+    static double depuisDouble(double v) { return v; }
+    static double versDouble(double v) { return v; }
+    static double seuilDerive() { return 1.5e-8; }   // sqrt(2.2e-16)
+};
+
+template<>
+struct TraitsScalaire<long double> {
+    static long double epsilon() { return 1e-13L; }
+    static long double abs(long double v) { return std::fabs(v); }
+    static long double depuisDouble(double v) { return v; }
+    static double versDouble(long double v) { return static_cast<double>(v); }
+    static double seuilDerive() { return 3.3e-10; }   // sqrt(1.1e-19)
+};
+
+//
+// Mémoire: les données d'un solveur sont allouées dans deux arènes
+// monotones propres à l'objet. Le modèle transformé vit dans la première,
+// libérée à la destruction. Tableau, base, noms et tableaux par colonne
+// vivent dans la seconde, rendue en bloc au début de chaque résolution
+// complète: des solve() répétés sur un même objet n'accumulent rien. Les
+// temporaires passent par un pool posé sur cette seconde arène, qui
+// réutilise leurs blocs d'un reoptimiser() à l'autre. Les arènes puisent
+// dans la ressource passée au constructeur: avec un pool réutilisé d'une
+// résolution à l'autre (voir ressourcememoire.h), un processus qui
+// enchaîne les résolutions n'appelle plus malloc en régime établi.
+//
+template<typename T>
+class SimplexSolverT {
+private:
+    template<typename U>
+    using Vecteur = std::pmr::vector<U>;
+
+    // Déclarées en premier: construites avant les conteneurs qui les
+    // utilisent, détruites après eux
+    std::pmr::monotonic_buffer_resource arene;             // modèle
+    std::pmr::monotonic_buffer_resource areneResolution;   // une résolution complète
+    std::pmr::unsynchronized_pool_resource temporaires;    // sur areneResolution, par lots de 4 blocs
+
+    Vecteur<T> fonctionObjectif;
+    Vecteur<Vecteur<T>> matriceContraintes;
+    Vecteur<T> Bi;
+    Vecteur<TypeContrainte> typesContraintes;
+    TypeObjectif typeObj;
+    Vecteur<bool> lignesInversees;   // lignes multipliées par -1 (Bi < 0)
+
+    // Lignes RANGE, ramenées à une ligne LEQ (l <= 0) ou GEQ (l > 0) dont
+    // l'écart est borné par la largeur u - l de l'intervalle
+    Vecteur<bool> ligneIntervalle;
+    Vecteur<T> etendueLigne;
+    bool intervalleVide;   // une ligne RANGE avec l > u
+
+    // Bornes supérieures des colonnes (écarts des lignes RANGE). Méthode
+    // des bornes: une colonne à sa borne porte u_j - x_j (colonneAuMax),
+    // de sorte que toute variable hors base vaut 0 dans le tableau
+    Vecteur<bool> colonneBornee;
+    Vecteur<T> borneColonne;
+    Vecteur<bool> colonneAuMax;
+
+    // Lignes GUB (bornes supérieures généralisées): sum x_j <= b_k sur
+    // des ensembles de variables disjoints, retirées du tableau. Chaque
+    // ensemble, complété par son écart g_k, a une variable clé hors base
+    // de travail qui vaut b_k moins les autres membres: la colonne de la
+    // clé est soustraite de celle des autres membres (Dantzig-Van Slyke)
+    bool modeGub;
+    Vecteur<int> ensembleVariable;   // ensemble de chaque variable de décision, -1 sinon
+    Vecteur<T> secondMembreGub;      // b_k
+    Vecteur<int> ensembleColonne;    // ensemble de chaque colonne du tableau, -1 sinon
+    Vecteur<int> cleGub;             // colonne clé de chaque ensemble (colonne nulle)
+    Vecteur<T> tauxCleGub;           // temporaires du test du rapport des clés
+    Vecteur<T> valeurCleGub;
+
+    // Coûts convexes par morceaux (concaves en MAX): points de rupture
+    // 0 = p_0 < p_1 < ... < p_k de x_j et pentes du sens MIN, une par
+    // segment. En phase 2, x_j = p_r + v (ou p_r - v si décroissante):
+    // la colonne porte v, ancrée au point r; au test du rapport (pas
+    // long), franchir un point relève la pente de l'arête au lieu de
+    // bloquer, et la variable est réancrée au point franchi
+    Vecteur<Vecteur<T>> pointsRupture;   // vide: coût linéaire
+    Vecteur<Vecteur<T>> pentesMorceaux;
+    Vecteur<int> ancreMorceau;
+    Vecteur<bool> morceauDecroissant;
+    int nbVariablesMorcelees;
+    bool coutsParMorceauxActifs;   // phase 2: les points de rupture comptent
+    struct PointFranchi {
+        T pas;          // rapport auquel la variable atteint le point
+        T hausse;       // relèvement de la pente de l'objectif
+        int colonne;
+        int ligne;      // -1: colonne entrante
+        int point;
+        bool decroissant;
+    };
+    Vecteur<PointFranchi> pointsFranchis;   // temporaire du pas long
+
+    Vecteur<TypeVariable> typesVariables;
+    Vecteur<bool> colonneInversee;   // la colonne j porte -x_j (x_j <= 0, ou libre décroissante)
+    Vecteur<bool> variableLibre;     // x_j s.r.s.: une seule colonne, sans borne
     int nbVariablesOriginales;
 
-    std::vector<std::vector<double>> tableau;
-    std::vector<int> base;
-    std::vector<std::string> nomsVariables;
+    Vecteur<Vecteur<T>> tableau;
+    Vecteur<int> base;
+    Vecteur<std::string> nomsVariables;   // noms courts: pas d'allocation (SSO)
+    // Ligne d'origine de chaque artificielle retirée alors qu'elle était
+    // encore en base (niveau 0, ligne redondante): sa colonne e_r complète
+    // la base dans calculerValeursDuales
+    Vecteur<int> lignesArtificiellesEnBase;
 
     int nbVariablesDecision;
     int nbContraintes;
@@ -35,40 +425,317 @@ private:
     int nbVariablesArtificielles;
 
     TypeSolution etatSolution;
-    double valeurObjectif;
-    std::vector<double> solutionOptimale;
+    T valeurObjectif;
+    Vecteur<T> solutionOptimale;
+    int nbIterations;
+
+    // Anti-cyclage: après SEUIL_STAGNATION pivots dégénérés consécutifs,
+    // règle de Bland (plus petits indices) jusqu'au prochain pivot non
+    // dégénéré, puis retour à Dantzig
+    static const int SEUIL_STAGNATION = 50;
+    int nbPivotsDegeneres;
+    int nbPivotsDegeneresConsecutifs;
+    bool regleBland;
+
+    // Crash: colonnes structurelles placées en base avant la phase 1 à la
+    // place des artificielles, par pivots qui préservent la réalisabilité
+    static constexpr double SEUIL_PIVOT_CRASH = 0.01;   // |pivot| relatif à la colonne
+    bool crashActif;
+    int nbPivotsCrash;
+
+    // Méthode composite: une seule phase qui minimise poids * W + Z, le
+    // poids croissant tant que la réalisabilité n'est pas atteinte
+    bool modeComposite;
+
+    const T EPSILON = TraitsScalaire<T>::epsilon();
 
-    const double EPSILON = 1e-10;
+    // Santé numérique: contrôles échantillonnés et réinversion
+    static const int PERIODE_CONTROLE = 100;
+    static constexpr double SEUIL_PIVOT_FAIBLE = 1e-7;
+    int periodeControle;
+    int iterationsDepuisControle;
+    bool controleAnticipe;      // pivot faible: contrôle à l'itération suivante
+    bool phaseRealisabilite;    // phase 1 ou composite: ligne W en place
+    bool reinversionEnCours;    // pivots de reconstruction: non mesurés
+    SanteNumerique sante;
+    // Colonnes d'écart, d'excédent et artificielles: ligne (-1 pour les
+    // variables de décision et les écarts GUB), et ||a_j||_1 de chaque colonne
+    Vecteur<int> ligneColonne;
+    Vecteur<bool> colonneArtificielle;
+    Vecteur<T> normeColonne;
+    // Temporaires des contrôles et de la réinversion
+    Vecteur<T> valeursControle;
+    Vecteur<T> coutsControle;
+    Vecteur<T> residusControle;
+    Vecteur<int> baseReinversion;
+    Vecteur<Vecteur<T>> tableauReinversion;
+
+    // Mode silencieux (pas de trace pédagogique) et arrêt coopératif
+    bool modeSilencieux;
+    const std::atomic<bool>* drapeauArret;
+    std::shared_ptr<const std::atomic<bool>> drapeauJeton;   // garde le drapeau du jeton en vie
+    bool interrompu;
+
+    // Budgets, vérifiés une fois par itération
+    LimitesResolution limites;
+    CauseArret causeArret;
+    long long unitesTravail;
+    std::chrono::steady_clock::time_point debutResolution;
+    bool solutionRealisable;   // solutionOptimale contient un point réalisable
+
+    // Certificats, rendus seulement s'ils passent la vérification: rayon
+    // de Farkas (une valeur par ligne) et rayon améliorant (une par variable)
+    Vecteur<T> rayonFarkas;
+    Vecteur<T> rayonNonBorne;
 
     void preprocessVariables();
+    void inverserColonne(int colonne);
+    void changerBorne(int colonne);
+    void substituerBorneSortante(int ligne);
+    void extraireLignesGub();
     void initialiserTableau();
+    // Vide les conteneurs d'une résolution et rend l'arène de résolution
+    void libererResolution();
     void ajouterVariablesSupplementaires();
     void phase1();
+    void initialiserObjectifPhase1(const Vecteur<bool>& estArtificielle);
+    void phaseComposite();
+    void crashBase(const Vecteur<bool>& estArtificielle);
     void phase2();
+    Vecteur<bool> colonnesArtificielles();
+    void sortirArtificiellesDeLaBase();
+    void retirerVariablesArtificielles();
+    void initialiserObjectifPhase2();
+    void calculerLigneCouts(int ligne);
+    // Coût de phase 2 (MIN) de la colonne j, moins celui de la clé de son ensemble
+    T coutPhase2(int j) const;
+    T coutTransforme(int j) const;
+    void activerCoutsParMorceaux();
+    int segmentMorceau(int j) const { return morceauDecroissant[j] ? ancreMorceau[j] - 1 : ancreMorceau[j]; }
+    T valeurAuPoint(int j, int point) const;
+    T coutReduitMorceau(int j) const;
+    void reancrerMorceau(int j, int point, bool decroissant);
+    void orienterColonneEntrante(int colPivot);
+    void ajouterPointsFranchis(int j, int ligne, T x0, T vitesse, bool& dur, T& pasDur,
+                               int& colonneDure, int& ligneDure);
+    bool franchirPointsRupture(int colPivot, int iteration, bool dur, T pasDur);
+    void iterationsPhase2();
     bool estOptimal(bool isPhase1);
     bool estNonBorne(int colPivot);
     int trouverColonnePivot(bool isPhase1);
-    int trouverLignePivot(int colPivot);
+    // Rend la ligne sortante, CHANGEMENT_BORNE si la colonne entrante
+    // atteint sa propre borne d'abord, ou -1; versBorneSup: la variable
+    // sortante quitte la base à sa borne supérieure; pas: le rapport minimal
+    static const int CHANGEMENT_BORNE = -2;
+    int trouverLignePivot(int colPivot, bool& versBorneSup, T& pas);
+    // Ensemble GUB dont la clé atteint 0 la première, ou -1
+    int trouverEnsembleBloquant(int colPivot, T& pas);
+    T valeurCle(int ensemble) const;
+    void changerCle(int ensemble, int colonne);
+    void remplacerCle(int ensemble, int colPivot, int iteration, bool pasNul);
+    void avancer(int colPivot, int iteration);
     void pivoter(int lignePivot, int colPivot);
+    void mesurerPivot(int lignePivot, int colPivot);
+    // Contrôle périodique, ou de fin de phase (final); true si le tableau
+    // a été réinversé
+    bool controlerSante(bool final);
+    // Mesures d'un contrôle; rend max(résidu, écart des coûts) relatifs
+    double mesurerSante(bool final);
+    // Coûts réduits de la ligne recalculés dans coutsControle; rend
+    // l'écart relatif à ceux du tableau et l'échelle qui a servi
+    T ecartCouts(int ligne, bool phase1, T& echelle);
+    bool reinverser();
+    // Optimum de la ligne de coûts, confirmé par le contrôle de fin de
+    // phase (une base réinversée peut ne plus être optimale)
+    bool optimumConfirme(bool isPhase1);
+    void suivreStagnation(bool pasNul);
     void extraireSolution();
+    void extraireRayonFarkas();
+    void extraireRayonNonBorne(int colPivot);
+    void convertirSolutionTransformee(const Vecteur<T>& transformedSolution);
 
     void afficherFormeStandard() const;
+    void afficherVariablesLibres() const;
+    std::string nomVariableDecision(int j) const;
     void afficherIntroductionVariablesArtificielles() const;
 
-    bool estZero(double val) const { return std::abs(val) < EPSILON; }
+    // |val| <= EPSILON: avec une tolérance nulle (arithmétique exacte), val == 0
+    bool estZero(const T& val) const { return !(TraitsScalaire<T>::abs(val) > EPSILON); }
+    bool estLibre(int colonne) const { return colonne >= 0 && colonne < nbVariablesDecision && variableLibre[colonne]; }
+    bool estBornee(int colonne) const { return colonne >= 0 && colonneBornee[colonne]; }
+    bool estMorcelee(int colonne) const {
+        return colonne >= 0 && colonne < nbVariablesDecision && !pointsRupture[colonne].empty();
+    }
+    // Coefficient de la colonne d'écart, d'excédent ou artificielle dans
+    // sa ligne d'origine
+    T coefficientEcart(int colonne) const {
+        return (!colonneArtificielle[colonne] && typesContraintes[ligneColonne[colonne]] == GEQ) ? T(-1) : T(1);
+    }
+    bool estMorceleeActive(int colonne) const { return coutsParMorceauxActifs && estMorcelee(colonne); }
+    // Coût réduit vu par le choix de la colonne entrante: une variable
+    // libre hors base peut entrer en croissant ou en décroissant, une
+    // variable à coût par morceaux repartir dans l'un ou l'autre sens
+    T coutReduitEntrant(int j) const {
+        const T& d = tableau[nbContraintes][j];
+        if (estMorceleeActive(j)) return coutReduitMorceau(j);
+        return (estLibre(j) && T(0) < d) ? -d : d;
+    }
+    bool arretDemande() const;
+    bool limiteAtteinte();
+    // Début de solve(), solveDepuisBase() ou reoptimiser(): chrono,
+    // compteurs, cause d'arrêt et mesures de santé repartent de zéro;
+    // état, solution et certificats de l'appel précédent sont effacés
+    void debuterResolution();
+    // Base finale d'une phase 2 terminée (OPTIMALE ou NON_BORNE), sans
+    // artificielle en base ni ligne de phase 1: reoptimiser() en repart
+    bool baseReprenable() const;
+    void resoudre();
+    std::ostream& journal() const { return fluxJournal(modeSilencieux); }
+
+    // Premiers blocs des arènes, de quoi ne pas redemander de mémoire:
+    // le modèle transformé d'un côté, le tableau, sa copie de
+    // réinversion et les tableaux par colonne de l'autre
+    static std::size_t tailleInitialeArene(std::size_t nbVariables, std::size_t nbContraintes) {
+        return (nbContraintes + 1) * (nbVariables * sizeof(T) + sizeof(Vecteur<T>))
+               + 4 * (nbVariables + nbContraintes) * sizeof(T) + 1024;
+    }
+    static std::size_t tailleInitialeResolution(std::size_t nbVariables, std::size_t nbContraintes) {
+        std::size_t colonnes = 2 * nbVariables + 2 * nbContraintes + 1;
+        return 2 * (nbContraintes + 2) * (colonnes * sizeof(T) + sizeof(Vecteur<T>))
+               + 8 * colonnes * sizeof(T) + 1024;
+    }
 
 public:
-    SimplexSolver(const std::vector<double>& fobj,
-                  const std::vector<std::vector<double>>& contraintes,
-                  const std::vector<double>& b,
-                  const std::vector<TypeContrainte>& types,
-                  TypeObjectif type,
-                  const std::vector<TypeVariable>& typesVar = std::vector<TypeVariable>());
+    SimplexSolverT(const std::vector<double>& fobj,
+                   const std::vector<std::vector<double>>& contraintes,
+                   const std::vector<double>& b,
+                   const std::vector<TypeContrainte>& types,
+                   TypeObjectif type,
+                   const std::vector<TypeVariable>& typesVar = std::vector<TypeVariable>(),
+                   std::pmr::memory_resource* ressource = std::pmr::get_default_resource())
+        : SimplexSolverT(fobj, contraintes, b, types, type, typesVar, std::vector<double>(), ressource) {}
+
+    // Avec lignes RANGE: bornesInf[i] <= contraintes[i].x <= b[i]
+    SimplexSolverT(const std::vector<double>& fobj,
+                   const std::vector<std::vector<double>>& contraintes,
+                   const std::vector<double>& b,
+                   const std::vector<TypeContrainte>& types,
+                   TypeObjectif type,
+                   const std::vector<TypeVariable>& typesVar,
+                   const std::vector<double>& bornesInf,
+                   std::pmr::memory_resource* ressource = std::pmr::get_default_resource())
+        : SimplexSolverT(VueProblemeLineaire(fobj, contraintes, b, types, type, typesVar, bornesInf), ressource) {}
+
+    // Lit directement le problème partagé (aucune copie intermédiaire)
+    explicit SimplexSolverT(const ProblemeLineaire& probleme,
+                            std::pmr::memory_resource* ressource = std::pmr::get_default_resource())
+        : SimplexSolverT(VueProblemeLineaire(probleme), ressource) {}
+
+    // Lit la vue coefficient par coefficient: avec VueProblemeLineaire::dual,
+    // le dual est résolu sans matérialiser la transposée
+    explicit SimplexSolverT(const VueProblemeLineaire& vue,
+                            std::pmr::memory_resource* ressource = std::pmr::get_default_resource());
 
     void solve();
+    // Après solve(): reprend la phase 2 depuis la base courante, qui reste
+    // réalisable quand seuls les coûts ont changé (setCoutVariable), sans
+    // reconstruire le tableau. Si l'appel précédent n'a pas fini sa phase 2
+    // (OPTIMALE ou NON_BORNE), résolution complète.
+    // Comme solve(), repart de budgets et de compteurs à zéro
+    void reoptimiser();
+    // Remplace c_j (coût linéaire), avant solve() ou entre deux
+    // reoptimiser(). Lève invalid_argument pour un coût par morceaux
+    void setCoutVariable(int j, double cout);
+    // Repart d'une base connue (indices de colonnes de la forme standard,
+    // sans variables artificielles), par ex. celle d'un autre moteur.
+    void solveDepuisBase(const std::vector<int>& baseInitiale);
     void afficherProbleme() const;
     void afficherTableau(int iteration, bool isPhase1 = false) const;
     void afficherSolution() const;
+
+    // Le drapeau (ou le jeton) et les budgets sont vérifiés une fois par
+    // itération. Au premier dépassement, solve() s'arrête avec l'état
+    // LIMITE_ATTEINTE et garde la meilleure base trouvée: en phase 2 elle
+    // est réalisable et sa solution est extraite (aSolutionRealisable()).
+    // Budgets et compteurs valent pour un appel: chaque solve(),
+    // solveDepuisBase() ou reoptimiser() repart de zéro.
+    void setModeSilencieux(bool silencieux) { modeSilencieux = silencieux; }
+    void setDrapeauArret(const std::atomic<bool>* drapeau) { drapeauArret = drapeau; }
+    void setJetonAnnulation(const JetonAnnulation& jeton) {
+        drapeauJeton = jeton.getDrapeau();
+        drapeauArret = drapeauJeton.get();
+    }
+    void setLimites(const LimitesResolution& l) { limites = l; }
+    // Pivots entre deux contrôles de santé numérique (0: aucun contrôle)
+    void setPeriodeControle(int periode) { periodeControle = periode; }
+    // Base de départ par crash (actif par défaut); false pour la phase 1
+    // du cours, qui part de toutes les artificielles
+    void setCrashBase(bool actif) { crashActif = actif; }
+    // Une seule phase au lieu de phase 1 puis reconstruction pour la phase 2
+    void setModeComposite(bool actif) { modeComposite = actif; }
+    // Lignes GUB hors du tableau (solve() seulement): la base de travail
+    // se réduit aux autres lignes, et getBase()/getNbContraintes() aussi.
+    // Les lignes sont extraites du modèle à la première résolution et
+    // n'y reviennent pas: les suivantes repartent des mêmes ensembles
+    void setModeGub(bool actif) { modeGub = actif; }
+    // Coût de x_j (>= 0) convexe par morceaux, concave en MAX: pentes[0]
+    // jusqu'à points[0], pentes[k] entre points[k-1] et points[k], la
+    // dernière au-delà. Remplace fonctionObjectif[j]; une seule colonne,
+    // pas de variable par segment. Sans effet sur la forme standard ni
+    // en mode composite (deux phases). Lève invalid_argument si les
+    // points ne croissent pas ou si les pentes ne sont pas monotones.
+    void setCoutParMorceaux(int j, const std::vector<double>& points, const std::vector<double>& pentes);
+
+    // Getters pour l'interface
+    TypeSolution getEtatSolution() const { return etatSolution; }
+    T getValeurObjectif() const { return valeurObjectif; }
+    std::vector<T> getSolutionOptimale() const { return std::vector<T>(solutionOptimale.begin(), solutionOptimale.end()); }
+    bool estInterrompu() const { return interrompu; }
+    CauseArret getCauseArret() const { return causeArret; }
+    long long getUnitesTravail() const { return unitesTravail; }
+    bool aSolutionRealisable() const { return solutionRealisable; }
+    int getNbIterations() const { return nbIterations; }
+    int getNbPivotsDegeneres() const { return nbPivotsDegeneres; }
+    int getNbPivotsCrash() const { return nbPivotsCrash; }
+    const SanteNumerique& getSanteNumerique() const { return sante; }
+    int getNbLignesGub() const { return static_cast<int>(secondMembreGub.size()); }
+    std::vector<int> getBase() const { return std::vector<int>(base.begin(), base.end()); }
+    // Certificat d'un état INFAISABLE (y, une valeur par ligne) ou
+    // NON_BORNE (r, une par variable: la solution rendue reste réalisable
+    // le long de x + t r), lu sur le tableau final; vide s'il n'a pas pu
+    // être établi (mode GUB, coûts par morceaux, ligne RANGE vide...).
+    // Contrôle indépendant: VueProblemeLineaire::estRayonFarkas/estRayonNonBorne
+    std::vector<T> getRayonFarkas() const { return std::vector<T>(rayonFarkas.begin(), rayonFarkas.end()); }
+    std::vector<T> getRayonNonBorne() const { return std::vector<T>(rayonNonBorne.begin(), rayonNonBorne.end()); }
+
+    // Forme standard de phase 2: variables de décision transformées puis
+    // variables d'écart t_k, coûts dans le sens de l'objectif d'origine.
+    // Une ligne RANGE y figure par sa forme LEQ/GEQ, sans la borne de son
+    // écart: les moteurs qui s'en servent travaillent sur sansIntervalles()
+    int getNbContraintes() const { return nbContraintes; }
+    int getNbColonnesFormeStandard() const;
+    std::vector<T> getColonneFormeStandard(int j) const;
+    T getCoutFormeStandard(int j) const;
+    std::vector<T> getSecondMembre() const { return std::vector<T>(Bi.begin(), Bi.end()); }
+    bool estLigneInversee(int i) const { return lignesInversees[i]; }
+    // Colonne libre: valeur de base de signe quelconque, coût réduit nul à l'optimum
+    bool estVariableLibre(int j) const { return estLibre(j); }
+    TypeObjectif getTypeObjectif() const { return typeObj; }
+    void appliquerSolutionFormeStandard(const std::vector<T>& xStandard);
+    // Valeurs duales y = c_B B^-1 de la base optimale, une par ligne dans
+    // le signe saisi (dZ/db_i). Même domaine que la forme standard; une
+    // artificielle restée en base y garde sa colonne unité, de coût nul.
+    // false si la résolution n'est pas optimale, en mode GUB (lignes
+    // retirées du tableau) ou si la base n'est pas factorisable
+    bool calculerValeursDuales(std::vector<T>& duales) const;
 };
 
+// Instanciations fournies par simplexsolver.cpp
+extern template class SimplexSolverT<float>;
+extern template class SimplexSolverT<double>;
+extern template class SimplexSolverT<long double>;
+
+// Moteur historique en double précision
+using SimplexSolver = SimplexSolverT<double>;
+
 #endif // SIMPLEXSOLVER_H
@@ -0,0 +1,95 @@
+#ifndef VERIFICATION_H
+#define VERIFICATION_H
+
+#include "simplexsolver.h"
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+//
+// Vérifications sans Qt ni framework: VERIFIER compte les échecs et
+// resultatVerifications() donne le code de sortie du programme.
+//
+
+inline int& nbEchecs() {
+    static int nb = 0;
+    return nb;
+}
+
+inline void verifier(bool condition, const char* texte, const char* fichier, int ligne) {
+    if (condition) return;
+    nbEchecs()++;
+    std::fprintf(stderr, "%s:%d: echec: %s\n", fichier, ligne, texte);
+}
+
+#define VERIFIER(condition) verifier((condition), #condition, __FILE__, __LINE__)
+
+inline int resultatVerifications(const char* nom) {
+    if (nbEchecs() == 0) {
+        std::printf("%s: ok\n", nom);
+        return 0;
+    }
+    std::printf("%s: %d echec(s)\n", nom, nbEchecs());
+    return 1;
+}
+
+// Comparaisons des moteurs en double à une référence exacte
+inline bool memeValeur(double valeur, double reference) {
+    return std::fabs(valeur - reference) <= 1e-7 * (1.0 + std::fabs(reference));
+}
+
+inline bool estRealisable(const ProblemeLineaire& p, const std::vector<double>& x) {
+    if (x.size() != p.fonctionObjectif.size()) return false;
+    for (size_t j = 0; j < x.size(); j++) {
+        if (p.typesVariables[j] == NON_NEGATIVE && x[j] < -1e-7) return false;
+        if (p.typesVariables[j] == NON_POSITIVE && x[j] > 1e-7) return false;
+    }
+    for (size_t i = 0; i < p.Bi.size(); i++) {
+        double ax = 0.0;
+        for (size_t j = 0; j < x.size(); j++) ax += p.matriceContraintes[i][j] * x[j];
+        double tolerance = 1e-7 * (1.0 + std::fabs(p.Bi[i]));
+        if (p.typesContraintes[i] != GEQ && ax > p.Bi[i] + tolerance) return false;
+        if (p.typesContraintes[i] != LEQ && ax < p.Bi[i] - tolerance) return false;
+    }
+    return true;
+}
+
+// Petit modèle aléatoire à coefficients entiers, reproductible par la
+// graine: les moteurs flottants peuvent être comparés au moteur exact.
+// colonneOpposee ajoute -x_1 comme variable: le dual reçoit une ligne
+// redondante, dont l'artificielle reste en base au niveau zéro
+inline ProblemePartage genererProbleme(std::mt19937& generateur, int n, int m, bool signesMixtes,
+                                       bool colonneOpposee = false) {
+    std::uniform_int_distribution<int> coefficient(-3, 6), secondMembre(-2, 12);
+    std::uniform_int_distribution<int> typeLigne(0, 2), typeVariable(0, signesMixtes ? 2 : 0), sens(0, 1);
+
+    std::vector<double> fobj;
+    std::vector<TypeVariable> typesVar;
+    for (int j = 0; j < n; j++) {
+        fobj.push_back(coefficient(generateur));
+        typesVar.push_back(static_cast<TypeVariable>(typeVariable(generateur)));
+    }
+
+    std::vector<std::vector<double>> contraintes;
+    std::vector<double> b;
+    std::vector<TypeContrainte> types;
+    for (int i = 0; i < m; i++) {
+        std::vector<double> ligne;
+        for (int j = 0; j < n; j++) ligne.push_back(coefficient(generateur));
+        contraintes.push_back(std::move(ligne));
+        b.push_back(secondMembre(generateur));
+        types.push_back(static_cast<TypeContrainte>(typeLigne(generateur)));   // LEQ, GEQ ou EQ
+    }
+    if (colonneOpposee) {
+        fobj.push_back(-fobj[0]);
+        typesVar.push_back(typesVar[0]);
+        for (std::vector<double>& ligne : contraintes) ligne.push_back(-ligne[0]);
+    }
+
+    TypeObjectif type = sens(generateur) ? MAX : MIN;
+    return ProblemeLineaire::creer(std::move(fobj), std::move(contraintes), std::move(b),
+                                   std::move(types), type, std::move(typesVar));
+}
+
+#endif // VERIFICATION_H
@@ -0,0 +1,52 @@
+#include "verification.h"
+#include "ressourcememoire.h"
+
+using namespace std;
+
+// Un pool par worker: après le premier lot, les arènes des solveurs sont
+// servies par le pool sans aucune allocation transmise à l'amont
+int main() {
+    mt19937 generateur(33);
+    vector<ProblemePartage> lot;
+    for (int k = 0; k < 50; k++) lot.push_back(genererProbleme(generateur, 2 + k % 4, 2 + k % 5, k % 2 == 1));
+    lot.push_back(genererProbleme(generateur, 10, 10, true));
+
+    CompteurAllocations compteur;
+    PoolSolveur pool(&compteur);
+
+    for (int tour = 0; tour < 3; tour++) {
+        compteur.reinitialiser();
+        for (const ProblemePartage& probleme : lot) {
+            SimplexSolver solver(*probleme, &pool);
+            solver.setModeSilencieux(true);
+            solver.solve();
+            VERIFIER(solver.getEtatSolution() != EN_COURS);
+        }
+        if (tour == 0) {
+            VERIFIER(compteur.getNbAllocations() > 0);
+        } else {
+            VERIFIER(compteur.getNbAllocations() == 0);
+        }
+    }
+
+    // Un même solveur résolu en boucle: chaque résolution complète rend
+    // la mémoire de la précédente, les reprises à chaud réutilisent celle
+    // des temporaires; le nombre de blocs tenus reste stable
+    CompteurAllocations direct;
+    SimplexSolver solver(*lot.back(), &direct);
+    solver.setModeSilencieux(true);
+    solver.solve();
+    solver.solve();
+    size_t blocsTenus = direct.getNbAllocations() - direct.getNbLiberations();
+    for (int k = 0; k < 20; k++) {
+        solver.solve();
+        solver.setCoutVariable(k % 10, k % 7 - 3);
+        solver.reoptimiser();
+        solver.reoptimiser();
+    }
+    solver.solve();
+    VERIFIER(solver.getEtatSolution() != EN_COURS);
+    VERIFIER(direct.getNbAllocations() - direct.getNbLiberations() <= blocsTenus);
+
+    return resultatVerifications("allocations");
+}
@@ -0,0 +1,40 @@
+#include "verification.h"
+
+using namespace std;
+
+// Tout modèle conclu infaisable ou non borné porte un certificat que la
+// vue du problème valide seule; un certificat retourné est rejeté
+int main() {
+    mt19937 generateur(36);
+    int nbInfaisables = 0;
+    int nbNonBornes = 0;
+
+    for (int k = 0; k < 400; k++) {
+        ProblemePartage probleme = genererProbleme(generateur, 2 + k % 4, 2 + (k / 4) % 5, k % 2 == 1);
+        VueProblemeLineaire vue(*probleme);
+
+        SimplexSolver solver(*probleme);
+        solver.setModeSilencieux(true);
+        solver.solve();
+
+        if (solver.getEtatSolution() == INFAISABLE) {
+            nbInfaisables++;
+            vector<double> y = solver.getRayonFarkas();
+            VERIFIER(vue.estRayonFarkas(y));
+            for (double& v : y) v = -v;
+            VERIFIER(!vue.estRayonFarkas(y));
+        } else if (solver.getEtatSolution() == NON_BORNE) {
+            nbNonBornes++;
+            vector<double> r = solver.getRayonNonBorne();
+            VERIFIER(vue.estRayonNonBorne(r));
+            for (double& v : r) v = -v;
+            VERIFIER(!vue.estRayonNonBorne(r));
+        }
+    }
+
+    // Le tirage doit couvrir les deux conclusions
+    VERIFIER(nbInfaisables > 0);
+    VERIFIER(nbNonBornes > 0);
+
+    return resultatVerifications("certificats");
+}
@@ -0,0 +1,24 @@
+#include "verification.h"
+#include "fixedsimplexsolver.h"
+#include <cmath>
+
+// L'exemple de fixedsimplexsolver.h, résolu par le compilateur: si ce
+// fichier compile, l'optimum est connu avant l'exécution
+constexpr ProblemeFixe<3, 2> probleme = {
+    {3, 5}, {{{1, 0}, {0, 2}, {3, 2}}}, {4, 12, 18}, {LEQ, LEQ, LEQ}, MAX,
+    {NON_NEGATIVE, NON_NEGATIVE}};
+static constexpr auto sol = solve(probleme);
+static_assert(sol.etat == OPTIMALE, "probleme infaisable ou non borne");
+static_assert(sol.valeurObjectif > 35.999 && sol.valeurObjectif < 36.001, "optimum Z = 36 attendu");
+
+int main() {
+    // Le même modèle à l'exécution par le moteur dynamique
+    SimplexSolver solver({3, 5}, {{1, 0}, {0, 2}, {3, 2}}, {4, 12, 18}, {LEQ, LEQ, LEQ}, MAX);
+    solver.setModeSilencieux(true);
+    solver.solve();
+    VERIFIER(solver.getEtatSolution() == OPTIMALE);
+    VERIFIER(std::fabs(solver.getValeurObjectif() - sol.valeurObjectif) < 1e-9);
+    VERIFIER(std::fabs(sol.x[0] - 2.0) < 1e-9 && std::fabs(sol.x[1] - 6.0) < 1e-9);
+
+    return resultatVerifications("fixe");
+}
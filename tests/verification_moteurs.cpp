@@ -0,0 +1,59 @@
+#include "verification.h"
+#include "rationnel.h"
+#include "dualsimplexsolver.h"
+#include "condensedsimplexsolver.h"
+
+using namespace std;
+
+// Le moteur exact sert de référence aux moteurs en double: même
+// conclusion, même optimum, et x* réalisable quand il est annoncé
+int main() {
+    mt19937 generateur(42);
+    for (int k = 0; k < 600; k++) {
+        ProblemePartage probleme = genererProbleme(generateur, 2 + k % 5, 2 + (k / 5) % 6, k % 3 == 0, k % 4 == 0);
+
+        SimplexSolverExact exact(*probleme);
+        exact.setModeSilencieux(true);
+        exact.solve();
+        TypeSolution etat = exact.getEtatSolution();
+        VERIFIER(etat == OPTIMALE || etat == INFAISABLE || etat == NON_BORNE);
+        double optimum = etat == OPTIMALE ? exact.getValeurObjectif().versDouble() : 0.0;
+
+        SimplexSolver primal(*probleme);
+        primal.setModeSilencieux(true);
+        primal.solve();
+        VERIFIER(primal.getEtatSolution() == etat);
+        if (etat == OPTIMALE && primal.getEtatSolution() == OPTIMALE) {
+            VERIFIER(memeValeur(primal.getValeurObjectif(), optimum));
+            VERIFIER(estRealisable(*probleme, primal.getSolutionOptimale()));
+        }
+
+        CondensedSimplexSolver condense(probleme);
+        condense.setModeSilencieux(true);
+        condense.solve();
+        VERIFIER(condense.getEtatSolution() == etat);
+        if (etat == OPTIMALE && condense.getEtatSolution() == OPTIMALE) {
+            VERIFIER(memeValeur(condense.getValeurObjectif(), optimum));
+            VERIFIER(estRealisable(*probleme, condense.getSolutionOptimale()));
+        }
+
+        // Dual infaisable: le primal est infaisable ou non borné, le
+        // moteur dual ne conclut pas (EN_COURS)
+        DualSimplexSolver dual(probleme);
+        dual.setModeSilencieux(true);
+        dual.solve();
+        if (etat == OPTIMALE) {
+            VERIFIER(dual.getEtatSolution() == OPTIMALE);
+            if (dual.getEtatSolution() == OPTIMALE) {
+                VERIFIER(memeValeur(dual.getValeurObjectifPrimal(), optimum));
+                VERIFIER(estRealisable(*probleme, dual.getSolutionPrimal()));
+                VERIFIER(dual.estDualiteVerifiee());
+            }
+        } else {
+            VERIFIER(dual.getEtatSolution() != OPTIMALE);
+            if (dual.getEtatSolution() == INFAISABLE) VERIFIER(etat == INFAISABLE);
+        }
+    }
+
+    return resultatVerifications("moteurs");
+}
@@ -0,0 +1,96 @@
+#include "verification.h"
+#include <cmath>
+
+using namespace std;
+
+// MIN x1 + x2, x1 + 2x2 >= 4, 3x1 + x2 >= 6, x1 + x2 <= 10: Z = 2.8
+static const vector<double> COUTS = {1, 1};
+static const vector<vector<double>> CONTRAINTES = {{1, 2}, {3, 1}, {1, 1}};
+static const vector<double> SECONDS_MEMBRES = {4, 6, 10};
+static const vector<TypeContrainte> TYPES = {GEQ, GEQ, LEQ};
+
+// Chaque appel repart de zéro: un second solve() arrêté par son budget ne
+// rend pas la solution du premier
+static void verifierLimiteAuSecondAppel() {
+    SimplexSolver solver(COUTS, CONTRAINTES, SECONDS_MEMBRES, TYPES, MIN);
+    solver.setModeSilencieux(true);
+    solver.setCrashBase(false);   // sans base de départ, la phase 1 prend deux itérations
+    solver.solve();
+    VERIFIER(solver.getEtatSolution() == OPTIMALE);
+    VERIFIER(fabs(solver.getValeurObjectif() - 2.8) < 1e-9);
+
+    LimitesResolution limites;
+    limites.maxIterations = 1;
+    solver.setLimites(limites);
+    solver.solve();
+    VERIFIER(solver.getEtatSolution() == LIMITE_ATTEINTE);
+    VERIFIER(solver.getCauseArret() == ARRET_ITERATIONS);
+    VERIFIER(!solver.aSolutionRealisable());
+    VERIFIER(solver.getSolutionOptimale().empty());
+    VERIFIER(solver.getValeurObjectif() == 0.0);
+
+    solver.setLimites(LimitesResolution());
+    solver.solve();
+    VERIFIER(solver.getEtatSolution() == OPTIMALE);
+    VERIFIER(!solver.estInterrompu());
+    VERIFIER(fabs(solver.getValeurObjectif() - 2.8) < 1e-9);
+    VERIFIER(solver.getNbIterations() > 1);
+}
+
+static bool estRealisable(const vector<double>& x) {
+    if (x.size() != COUTS.size()) return false;
+    for (size_t i = 0; i < CONTRAINTES.size(); i++) {
+        double ax = 0.0;
+        for (size_t j = 0; j < x.size(); j++) ax += CONTRAINTES[i][j] * x[j];
+        if (TYPES[i] == GEQ && ax < SECONDS_MEMBRES[i] - 1e-9) return false;
+        if (TYPES[i] == LEQ && ax > SECONDS_MEMBRES[i] + 1e-9) return false;
+    }
+    return x[0] >= -1e-9 && x[1] >= -1e-9;
+}
+
+// Arrêté en phase 1, le tableau n'a pas de base réalisable: reoptimiser()
+// doit tout reprendre au lieu de relancer la phase 2 dessus
+static void verifierReoptimisationApresArret() {
+    SimplexSolver solver(COUTS, CONTRAINTES, SECONDS_MEMBRES, TYPES, MIN);
+    solver.setModeSilencieux(true);
+    solver.setCrashBase(false);
+    solver.solve();
+
+    LimitesResolution limites;
+    limites.maxIterations = 1;
+    solver.setLimites(limites);
+    solver.solve();
+    VERIFIER(solver.getEtatSolution() == LIMITE_ATTEINTE);
+
+    solver.setLimites(LimitesResolution());
+    solver.reoptimiser();
+    VERIFIER(solver.getEtatSolution() == OPTIMALE);
+    VERIFIER(fabs(solver.getValeurObjectif() - 2.8) < 1e-9);
+    VERIFIER(estRealisable(solver.getSolutionOptimale()));
+
+    // Depuis l'optimum, la reprise à chaud garde la base réalisable:
+    // MIN 3x1 + x2 a son optimum en (0, 6)
+    solver.setCoutVariable(0, 3);
+    solver.reoptimiser();
+    VERIFIER(solver.getEtatSolution() == OPTIMALE);
+    VERIFIER(fabs(solver.getValeurObjectif() - 6.0) < 1e-9);
+    VERIFIER(estRealisable(solver.getSolutionOptimale()));
+}
+
+// Après une infaisabilité, reoptimiser() conclut de même
+static void verifierReoptimisationApresInfaisabilite() {
+    SimplexSolver solver({1, 1}, {{1, 1}, {1, 1}}, {1, 3}, {LEQ, GEQ}, MAX);
+    solver.setModeSilencieux(true);
+    solver.solve();
+    VERIFIER(solver.getEtatSolution() == INFAISABLE);
+    solver.reoptimiser();
+    VERIFIER(solver.getEtatSolution() == INFAISABLE);
+    VERIFIER(!solver.aSolutionRealisable());
+}
+
+int main() {
+    verifierLimiteAuSecondAppel();
+    verifierReoptimisationApresArret();
+    verifierReoptimisationApresInfaisabilite();
+    return resultatVerifications("reprise");
+}
@@ -0,0 +1,112 @@
+#include "verification.h"
+#include "rationnel.h"
+#include "concurrentsimplexsolver.h"
+#include "mixedprecisionsimplexsolver.h"
+#include "verifiedsimplexsolver.h"
+#include "autosimplexsolver.h"
+#include "iissimplexsolver.h"
+
+using namespace std;
+
+// Les moteurs construits sur SimplexSolverT, comparés au moteur exact:
+// même conclusion, même optimum, et x* réalisable quand il est annoncé
+static void verifierContreExact(const ProblemePartage& probleme) {
+    SimplexSolverExact exact(*probleme);
+    exact.setModeSilencieux(true);
+    exact.solve();
+    TypeSolution etat = exact.getEtatSolution();
+    VERIFIER(etat == OPTIMALE || etat == INFAISABLE || etat == NON_BORNE);
+    double optimum = etat == OPTIMALE ? exact.getValeurObjectif().versDouble() : 0.0;
+
+    ConcurrentSimplexSolver concurrent(probleme);
+    concurrent.solve();
+    VERIFIER(concurrent.aUnGagnant());
+    VERIFIER(concurrent.getEtatSolution() == etat);
+    if (etat == OPTIMALE && concurrent.getEtatSolution() == OPTIMALE) {
+        VERIFIER(memeValeur(concurrent.getValeurObjectif(), optimum));
+        VERIFIER(estRealisable(*probleme, concurrent.getSolutionOptimale()));
+    }
+
+    MixedPrecisionSimplexSolver mixte(probleme);
+    mixte.setModeSilencieux(true);
+    mixte.solve();
+    VERIFIER(mixte.getEtatSolution() == etat);
+    if (etat == OPTIMALE && mixte.getEtatSolution() == OPTIMALE) {
+        VERIFIER(memeValeur(mixte.getValeurObjectif(), optimum));
+        VERIFIER(estRealisable(*probleme, mixte.getSolutionOptimale()));
+    }
+
+    // L'optimum vérifié est exact: égal à celui du moteur exact
+    VerifiedSimplexSolver verifie(probleme);
+    verifie.setModeSilencieux(true);
+    verifie.solve();
+    VERIFIER(verifie.getEtatSolution() == etat);
+    if (etat == OPTIMALE && verifie.getEtatSolution() == OPTIMALE) {
+        VERIFIER(verifie.getValeurObjectifExacte() == exact.getValeurObjectif());
+        VERIFIER(verifie.getResultatVerification() != NON_VERIFIEE);
+        VERIFIER(estRealisable(*probleme, verifie.getSolutionOptimale()));
+    }
+
+    for (ChoixFormulation formulation : {FORMULATION_PRIMALE, FORMULATION_DUALE, FORMULATION_AUTO}) {
+        AutoSimplexSolver automatique(probleme);
+        automatique.setModeSilencieux(true);
+        automatique.setFormulation(formulation);
+        automatique.solve();
+        VERIFIER(automatique.getEtatSolution() == etat);
+        if (etat == OPTIMALE && automatique.getEtatSolution() == OPTIMALE) {
+            VERIFIER(memeValeur(automatique.getValeurObjectif(), optimum));
+            VERIFIER(estRealisable(*probleme, automatique.getSolutionOptimale()));
+        }
+    }
+}
+
+// x1 + x2 = 8 posée deux fois: la seconde ligne est redondante, son
+// artificielle reste en base (-1) et la base se certifie sans elle
+static void verifierLigneRedondante() {
+    VerifiedSimplexSolver solver(ProblemeLineaire::creer({3, 5}, {{1, 0}, {0, 2}, {3, 2}, {1, 1}, {2, 2}},
+                                                         {4, 12, 18, 8, 16}, {LEQ, LEQ, LEQ, EQ, EQ}, MAX));
+    solver.setModeSilencieux(true);
+    solver.solve();
+    VERIFIER(solver.getEtatSolution() == OPTIMALE);
+    VERIFIER(solver.getValeurObjectifExacte() == Rationnel(36));
+    VERIFIER(solver.getResultatVerification() == CERTIFIEE);
+    VERIFIER(solver.estPrimalRealisable() && solver.estDualRealisable() && solver.respecteEcartsComplementaires());
+    VERIFIER(solver.getValeursDualesExactes().size() == 5);
+}
+
+// x1 + x2 >= 5 est incompatible avec x1 <= 1 et x2 <= 1; la dernière
+// ligne n'y prend aucune part
+static void verifierIIS() {
+    ProblemePartage probleme = ProblemeLineaire::creer({1, 1}, {{1, 1}, {1, 0}, {0, 1}, {1, -1}},
+                                                       {5, 1, 1, 10}, {GEQ, LEQ, LEQ, LEQ}, MIN);
+    IisSimplexSolver solver(probleme);
+    solver.setModeSilencieux(true);
+    solver.solve();
+    VERIFIER(solver.getEtatSolution() == INFAISABLE);
+    VERIFIER(solver.getIIS() == vector<int>({0, 1, 2}));
+    VERIFIER(!solver.getRayonFarkas().empty());
+
+    // Un modèle réalisable n'a pas d'IIS
+    IisSimplexSolver realisable(ProblemeLineaire::creer({3, 5}, {{1, 0}, {0, 2}, {3, 2}}, {4, 12, 18},
+                                                        {LEQ, LEQ, LEQ}, MAX));
+    realisable.setModeSilencieux(true);
+    realisable.solve();
+    VERIFIER(realisable.getEtatSolution() == OPTIMALE);
+    VERIFIER(realisable.getIIS().empty());
+}
+
+int main() {
+    // L'exemple de fixedsimplexsolver.h: Z = 36 en (2, 6)
+    verifierContreExact(ProblemeLineaire::creer({3, 5}, {{1, 0}, {0, 2}, {3, 2}}, {4, 12, 18},
+                                                {LEQ, LEQ, LEQ}, MAX));
+
+    mt19937 generateur(45);
+    for (int k = 0; k < 300; k++) {
+        verifierContreExact(genererProbleme(generateur, 2 + k % 4, 2 + (k / 4) % 6, k % 3 == 0, k % 4 == 0));
+    }
+
+    verifierLigneRedondante();
+    verifierIIS();
+
+    return resultatVerifications("resolveurs");
+}
@@ -0,0 +1,33 @@
+#include "verification.h"
+
+using namespace std;
+
+// MIN sum x, H x = H 1 sur la matrice de Hilbert d'ordre 12: optimum
+// Z = 12 en x = 1, à 2e-5 près en double (kappa ~ 1e16). Le tableau y
+// dérive de quelques 1e-10, l'arrondi ordinaire de ses pivots: le
+// reconstruire ne change rien, aucune réinversion n'est attendue
+int main() {
+    const int n = 12;
+    vector<vector<double>> hilbert(n, vector<double>(n));
+    vector<double> b(n, 0.0);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            hilbert[i][j] = 1.0 / (i + j + 1);
+            b[i] += hilbert[i][j];
+        }
+    }
+
+    SimplexSolver solver(vector<double>(n, 1.0), hilbert, b, vector<TypeContrainte>(n, EQ), MIN);
+    solver.setModeSilencieux(true);
+    solver.solve();
+    VERIFIER(solver.getEtatSolution() == OPTIMALE);
+    VERIFIER(fabs(solver.getValeurObjectif() - 12.0) < 1e-4);
+
+    const SanteNumerique& sante = solver.getSanteNumerique();
+    VERIFIER(sante.nbControles > 0);
+    VERIFIER(sante.nbReinversions == 0);
+    VERIFIER(sante.ecartCoutsMax < TraitsScalaire<double>::seuilDerive());
+    VERIFIER(sante.residuPrimalMax < TraitsScalaire<double>::seuilDerive());
+
+    return resultatVerifications("sante");
+}
@@ -0,0 +1,214 @@
+#include "verifiedsimplexsolver.h"
+#include "factorisationlu.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace std;
+
+VerifiedSimplexSolver::VerifiedSimplexSolver(ProblemePartage problemePartage)
+    : probleme(std::move(problemePartage)), problemeDeveloppe(ProblemeLineaire::sansIntervalles(probleme)) {
+
+    etatSolution = EN_COURS;
+    verification = NON_VERIFIEE;
+
+    primalRealisable = false;
+    dualRealisable = false;
+    ecartsComplementaires = false;
+    nbIterationsDouble = 0;
+    nbIterationsExactes = 0;
+
+    modeSilencieux = false;
+}
+
+bool VerifiedSimplexSolver::certifierBase(SimplexSolverExact& solverExact, const vector<int>& base) {
+    int m = solverExact.getNbContraintes();
+    int n = solverExact.getNbColonnesFormeStandard();
+
+    primalRealisable = false;
+    dualRealisable = false;
+    ecartsComplementaires = false;
+
+    // Base sans doublon. -1: artificielle restée en base au niveau zéro,
+    // ligne redondante retirée après la phase 1; B se restreint aux
+    // autres lignes (elle reste carrée et inversible en développant le
+    // déterminant le long des colonnes unitaires des artificielles)
+    vector<bool> estBasique(n, false);
+    vector<int> lignes, colonnesBase;
+    for (int k = 0; k < m; k++) {
+        int j = base[k];
+        if (j == -1) continue;
+        if (j < 0 || j >= n || estBasique[j]) return false;
+        estBasique[j] = true;
+        lignes.push_back(k);
+        colonnesBase.push_back(j);
+    }
+    int r = static_cast<int>(lignes.size());
+
+    vector<vector<Rationnel>> colonnes(n);
+    for (int j = 0; j < n; j++) {
+        colonnes[j] = solverExact.getColonneFormeStandard(j);
+    }
+    vector<Rationnel> b = solverExact.getSecondMembre();
+
+    vector<vector<Rationnel>> B(r, vector<Rationnel>(r));
+    vector<Rationnel> cB(r), bB(r);
+    for (int k = 0; k < r; k++) {
+        for (int i = 0; i < r; i++) {
+            B[i][k] = colonnes[colonnesBase[k]][lignes[i]];
+        }
+        cB[k] = solverExact.getCoutFormeStandard(colonnesBase[k]);
+        bB[k] = b[lignes[k]];
+    }
+
+    FactorisationLU<Rationnel> lu;
+    if (!lu.factoriser(B)) return false;
+
+    vector<Rationnel> xB = lu.resoudre(bB);
+    vector<Rationnel> yB = lu.resoudreTransposee(cB);
+    // Multiplicateur nul pour une ligne retirée
+    vector<Rationnel> y(m, Rationnel(0));
+    for (int k = 0; k < r; k++) {
+        y[lignes[k]] = yB[k];
+    }
+
+    // 1. Réalisabilité primale
+    //    (une variable libre en base peut être négative)
+    primalRealisable = true;
+    vector<Rationnel> xStandard(n, Rationnel(0));
+    for (int k = 0; k < r; k++) {
+        if (xB[k].signe() < 0 && !solverExact.estVariableLibre(colonnesBase[k])) primalRealisable = false;
+        xStandard[colonnesBase[k]] = xB[k];
+    }
+    //    Une ligne retirée n'est pas supposée redondante: vérifiée en x
+    for (int i = 0; i < m; i++) {
+        if (base[i] != -1) continue;
+        Rationnel ax(0);
+        for (int j = 0; j < n; j++) {
+            if (colonnes[j][i].signe() != 0 && xStandard[j].signe() != 0) ax += colonnes[j][i] * xStandard[j];
+        }
+        if (ax != b[i]) primalRealisable = false;
+    }
+
+    // 2. Réalisabilité duale: d_j = c_j - y.a_j du bon signe, nul pour
+    //    une variable libre
+    //    3. Écarts complémentaires: x_j * d_j = 0 pour tout j
+    dualRealisable = true;
+    ecartsComplementaires = true;
+    for (int j = 0; j < n; j++) {
+        Rationnel d = solverExact.getCoutFormeStandard(j);
+        for (int i = 0; i < m; i++) {
+            if (colonnes[j][i].signe() != 0) d -= y[i] * colonnes[j][i];
+        }
+        if (solverExact.estVariableLibre(j) ? d.signe() != 0
+                : (probleme->typeObj == MAX && d.signe() > 0) || (probleme->typeObj == MIN && d.signe() < 0)) {
+            dualRealisable = false;
+        }
+        if (d.signe() != 0 && xStandard[j].signe() != 0) {
+            ecartsComplementaires = false;
+        }
+    }
+
+    if (!(primalRealisable && dualRealisable && ecartsComplementaires)) return false;
+
+    solverExact.appliquerSolutionFormeStandard(xStandard);
+    valeurObjectifExacte = solverExact.getValeurObjectif();
+    solutionExacte = solverExact.getSolutionOptimale();
+
+    valeursDualesExactes.resize(m);
+    for (int i = 0; i < m; i++) {
+        valeursDualesExactes[i] = solverExact.estLigneInversee(i) ? -y[i] : y[i];
+    }
+    probleme->replierValeursDuales(valeursDualesExactes);
+    return true;
+}
+
+void VerifiedSimplexSolver::solve() {
+    // 1. Résolution rapide en double
+    SimplexSolver solverDouble(*problemeDeveloppe);
+    solverDouble.setModeSilencieux(true);
+    solverDouble.solve();
+    nbIterationsDouble = solverDouble.getNbIterations();
+    nbIterationsExactes = 0;
+
+    etatSolution = solverDouble.getEtatSolution();
+    verification = NON_VERIFIEE;
+    valeursDualesExactes.clear();
+    if (etatSolution != OPTIMALE) {
+        valeurObjectifExacte = Rationnel(0);
+        solutionExacte.clear();
+        if (!modeSilencieux) afficherSolution();
+        return;
+    }
+
+    // 2. Certificat exact de la base finale
+    SimplexSolverExact solverExact(*problemeDeveloppe);
+    solverExact.setModeSilencieux(true);
+
+    if (certifierBase(solverExact, solverDouble.getBase())) {
+        verification = CERTIFIEE;
+    } else {
+        // 3. Certificat rejeté: on continue en exact depuis cette base
+        solverExact.solveDepuisBase(solverDouble.getBase());
+        nbIterationsExactes = solverExact.getNbIterations();
+        verification = CORRIGEE_EN_EXACT;
+
+        etatSolution = solverExact.getEtatSolution();
+        valeurObjectifExacte = solverExact.getValeurObjectif();
+        solutionExacte = solverExact.getSolutionOptimale();
+        if (etatSolution == OPTIMALE) {
+            certifierBase(solverExact, solverExact.getBase());
+        }
+    }
+
+    if (!modeSilencieux) afficherSolution();
+}
+
+vector<double> VerifiedSimplexSolver::getSolutionOptimale() const {
+    vector<double> solution;
+    for (const Rationnel& v : solutionExacte) {
+        solution.push_back(v.versDouble());
+    }
+    return solution;
+}
+
+void VerifiedSimplexSolver::afficherSolution() const {
+    cout << "\n" << string(80, '=') << endl;
+    cout << "SOLUTION CERTIFIEE EN ARITHMETIQUE EXACTE" << endl;
+    cout << string(80, '=') << "\n\n";
+
+    if (etatSolution == OPTIMALE) {
+        if (verification == CERTIFIEE) {
+            cout << "*** BASE DU DOUBLE CERTIFIEE OPTIMALE ***\n\n";
+        } else {
+            cout << "*** CERTIFICAT REJETE: " << nbIterationsExactes
+                 << " pivot(s) supplementaire(s) en exact ***\n\n";
+        }
+
+        cout << "Valeur optimale de Z = " << valeurObjectifExacte
+             << "  (" << fixed << setprecision(4) << valeurObjectifExacte.versDouble() << ")\n\n";
+        cout << "Variables de decision:\n";
+        for (size_t i = 0; i < solutionExacte.size(); i++) {
+            cout << "  x" << (i + 1) << " = " << solutionExacte[i] << endl;
+        }
+
+        if (!valeursDualesExactes.empty()) {
+            cout << "\nValeurs duales:\n";
+            for (size_t i = 0; i < valeursDualesExactes.size(); i++) {
+                cout << "  y" << (i + 1) << " = " << valeursDualesExactes[i] << endl;
+            }
+        }
+
+        if (primalRealisable && dualRealisable && ecartsComplementaires) {
+            cout << "\nCertificat: realisabilite primale OK, realisabilite duale OK, ecarts complementaires OK\n";
+        } else {
+            // Base finale non recertifiable: l'optimum vient du simplexe exact
+            cout << "\nCertificat: optimalite etablie par la re-resolution exacte\n";
+        }
+    } else if (etatSolution == NON_BORNE) {
+        cout << "*** PROBLEME NON BORNE (non certifie) ***\n";
+    } else if (etatSolution == INFAISABLE) {
+        cout << "*** AUCUNE SOLUTION REALISABLE (non certifie) ***\n";
+    }
+
+    cout << "\n" << string(80, '=') << endl;
+}
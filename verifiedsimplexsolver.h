@@ -0,0 +1,72 @@
+#ifndef VERIFIEDSIMPLEXSOLVER_H
+#define VERIFIEDSIMPLEXSOLVER_H
+
+#include "simplexsolver.h"
+#include "rationnel.h"
+#include <vector>
+
+enum ResultatVerification {
+    NON_VERIFIEE,       // pas de base optimale à certifier
+    CERTIFIEE,          // la base du double est optimale en arithmétique exacte
+    CORRIGEE_EN_EXACT   // certificat rejeté: pivots supplémentaires en exact
+};
+
+//
+// Résolution rapide en double puis certificat exact de la base finale:
+// B x_B = b et B^T y = c_B sont résolus en rationnels, puis on vérifie
+// la réalisabilité primale (x_B >= 0), la réalisabilité duale (signe des
+// coûts réduits) et les écarts complémentaires. En cas d'échec, la
+// résolution continue en arithmétique exacte à partir de cette base.
+// Une ligne redondante retirée après la phase 1 (-1 dans la base) sort
+// de B avec un multiplicateur nul; elle est vérifiée au point obtenu.
+//
+// Le modèle certifié est celui des coefficients saisis, convertis en
+// fractions exactes (0.1 -> 1/10).
+//
+class VerifiedSimplexSolver {
+private:
+    ProblemePartage probleme;
+    ProblemePartage problemeDeveloppe;   // lignes RANGE en deux lignes: bases sans bornes
+
+    // Résultats
+    TypeSolution etatSolution;
+    ResultatVerification verification;
+    Rationnel valeurObjectifExacte;
+    std::vector<Rationnel> solutionExacte;
+    std::vector<Rationnel> valeursDualesExactes;
+
+    // Détail du certificat
+    bool primalRealisable;
+    bool dualRealisable;
+    bool ecartsComplementaires;
+    int nbIterationsDouble;
+    int nbIterationsExactes;
+
+    bool modeSilencieux;
+
+    bool certifierBase(SimplexSolverExact& solverExact, const std::vector<int>& base);
+
+public:
+    explicit VerifiedSimplexSolver(ProblemePartage problemePartage);
+
+    void setModeSilencieux(bool silencieux) { modeSilencieux = silencieux; }
+
+    void solve();
+    void afficherSolution() const;
+
+    // Getters pour l'interface
+    TypeSolution getEtatSolution() const { return etatSolution; }
+    ResultatVerification getResultatVerification() const { return verification; }
+    Rationnel getValeurObjectifExacte() const { return valeurObjectifExacte; }
+    std::vector<Rationnel> getSolutionExacte() const { return solutionExacte; }
+    std::vector<Rationnel> getValeursDualesExactes() const { return valeursDualesExactes; }
+    double getValeurObjectif() const { return valeurObjectifExacte.versDouble(); }
+    std::vector<double> getSolutionOptimale() const;
+    bool estPrimalRealisable() const { return primalRealisable; }
+    bool estDualRealisable() const { return dualRealisable; }
+    bool respecteEcartsComplementaires() const { return ecartsComplementaires; }
+    int getNbIterationsDouble() const { return nbIterationsDouble; }
+    int getNbIterationsExactes() const { return nbIterationsExactes; }
+};
+
+#endif // VERIFIEDSIMPLEXSOLVER_H